@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "Arena.h"
 #include "../log/Log.h"
@@ -73,6 +74,44 @@ void *ArenaAllocate(Arena *arena, const size_t n) {
     return return_pointer;
 }
 
+void *ArenaReallocate(Arena *arena, void *pointer, const size_t old_size, const size_t new_size) {
+    //Nothing to resize, behave like a normal allocation
+    if (pointer == NULL) {
+        return ArenaAllocate(arena, new_size);
+    }
+
+    const size_t old_aligned = BIT_ALIGNMENT_8(old_size);
+    const size_t new_aligned = BIT_ALIGNMENT_8(new_size);
+
+    //If the allocation ends at the current offset it is the last one, so it can grow or shrink in place
+    if ((char *) pointer + old_aligned == arena->base + arena->offset) {
+        const size_t start = (size_t) ((char *) pointer - arena->base);
+        if (start + new_aligned <= arena->size) {
+            arena->offset = start + new_aligned;
+
+            //Setup message buffer
+            char message_buffer[100];
+
+            //Write formatted string
+            snprintf(message_buffer, sizeof message_buffer,
+                     "Arena at %p resized %p in place from %zu to %zu bytes\n",
+                     arena, pointer, old_aligned, new_aligned);
+            //Log the message
+            Log(INFO, message_buffer);
+
+            return pointer;
+        }
+    }
+
+    //Otherwise allocate a new block and move the contents over
+    void *new_pointer = ArenaAllocate(arena, new_size);
+    if (new_pointer == NULL) {
+        return NULL;
+    }
+    memcpy(new_pointer, pointer, old_size < new_size ? old_size : new_size);
+    return new_pointer;
+}
+
 void FlushArena(Arena *arena) {
     arena->offset = 0;
 }
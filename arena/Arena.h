@@ -45,6 +45,18 @@ Arena *CreateArena(size_t size);
  */
 void *ArenaAllocate(Arena *arena, size_t n);
 
+/**
+ * @brief           Resizes an allocation of the given arena. If the allocation is the last one made in the arena
+ *                  and the arena has room, it is extended (or shrunk) in place, otherwise a new block is allocated
+ *                  and the old contents are copied to it. The old block is not reclaimed in that case.
+ * @param arena     Arena the allocation belongs to
+ * @param pointer   The allocation to resize, NULL to allocate a new block
+ * @param old_size  The size the allocation was requested with
+ * @param new_size  The requested new size
+ * @return          The address of the resized allocation or NULL on failure
+ */
+void *ArenaReallocate(Arena *arena, void *pointer, size_t old_size, size_t new_size);
+
 /**
  * @brief           Clears a given arena
  * @param arena     Arena to be flushed
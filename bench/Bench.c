@@ -0,0 +1,253 @@
+/**
+ * @file    Bench.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Micro-benchmark harness implementation
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define BENCH_HAS_TSC 1
+#else
+    #define BENCH_HAS_TSC 0
+#endif
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+#ifdef __linux__
+    #include <string.h>
+    #include <unistd.h>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+#endif
+
+#include "Bench.h"
+
+long long BenchNowNanoseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (long long) ((double) counter.QuadPart * 1e9 / (double) frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+unsigned long long BenchCycles(void) {
+#if BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+double BenchCountCacheMisses(const BenchFunction function, void *context, const size_t iterations) {
+#ifdef __linux__
+    //Last level cache misses of this thread in user space
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof attributes);
+    attributes.size = sizeof attributes;
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    const int counter = (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+    if (counter < 0) {
+        return -1;
+    }
+
+    ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+    ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    function(context, iterations);
+    ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+
+    long long misses = 0;
+    const ssize_t read_size = read(counter, &misses, sizeof misses);
+    close(counter);
+    return read_size == (ssize_t) sizeof misses ? (double) misses : -1;
+#else
+    (void) function;
+    (void) context;
+    (void) iterations;
+    return -1;
+#endif
+}
+
+void BenchDoNotOptimize(const void *pointer) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ volatile("" : : "g"(pointer) : "memory");
+#else
+    static const void *volatile sink;
+    sink = pointer;
+#endif
+}
+
+static int CompareDoubles(const void *a, const void *b) {
+    const double x = *(const double *) a;
+    const double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+int BenchRun(BenchResult *result, const char *group, const char *name, const BenchFunction function, void *context,
+             const size_t bytes_per_op, const BenchConfig *config) {
+    if (config->repetitions == 0) {
+        return 1;
+    }
+
+    //Per repetition samples, nanoseconds and cycles per operation
+    double *samples = malloc(sizeof(double) * config->repetitions);
+    double *cycle_samples = malloc(sizeof(double) * config->repetitions);
+    if (samples == NULL || cycle_samples == NULL) {
+        free(samples);
+        free(cycle_samples);
+        return 1;
+    }
+
+    //Calibrate: double the iterations until a repetition takes long enough.
+    //The first calls double as the first warm-up.
+    size_t iterations = 1;
+    for (;;) {
+        const long long start = BenchNowNanoseconds();
+        function(context, iterations);
+        const long long elapsed = BenchNowNanoseconds() - start;
+        if (elapsed >= config->min_repetition_ns || iterations >= ((size_t) 1 << 40)) {
+            break;
+        }
+        //Jump close to the target once the timer resolution is no longer a concern
+        if (elapsed > 1000) {
+            const double scale = (double) config->min_repetition_ns / (double) elapsed;
+            iterations = (size_t) ((double) iterations * scale) + 1;
+        }
+        else {
+            iterations *= 2;
+        }
+    }
+
+    //Warm-up
+    for (size_t i = 0; i < config->warmup_repetitions; i++) {
+        function(context, iterations);
+    }
+
+    //Recorded repetitions
+    double sum = 0;
+    for (size_t i = 0; i < config->repetitions; i++) {
+        const unsigned long long cycles_start = BenchCycles();
+        const long long start = BenchNowNanoseconds();
+        function(context, iterations);
+        const long long elapsed = BenchNowNanoseconds() - start;
+        const unsigned long long cycles = BenchCycles() - cycles_start;
+
+        samples[i] = (double) elapsed / (double) iterations;
+        cycle_samples[i] = (double) cycles / (double) iterations;
+        sum += samples[i];
+    }
+
+    qsort(samples, config->repetitions, sizeof(double), CompareDoubles);
+    qsort(cycle_samples, config->repetitions, sizeof(double), CompareDoubles);
+
+    //Nearest-rank percentiles
+    const size_t median_index = (config->repetitions - 1) / 2;
+    size_t p99_index = (config->repetitions * 99 + 99) / 100;
+    if (p99_index > 0) {
+        p99_index--;
+    }
+    if (p99_index >= config->repetitions) {
+        p99_index = config->repetitions - 1;
+    }
+
+    result->group = group;
+    result->name = name;
+    result->iterations = iterations;
+    result->repetitions = config->repetitions;
+    result->bytes_per_op = bytes_per_op;
+    result->median_ns = samples[median_index];
+    result->p99_ns = samples[p99_index];
+    result->min_ns = samples[0];
+    result->mean_ns = sum / (double) config->repetitions;
+    result->cycles_per_byte = -1;
+    result->mb_per_s = 0;
+    result->counter_name = NULL;
+    result->counter = 0;
+    result->second_counter_name = NULL;
+    result->second_counter = 0;
+
+    if (bytes_per_op > 0) {
+        if (BENCH_HAS_TSC) {
+            result->cycles_per_byte = cycle_samples[median_index] / (double) bytes_per_op;
+        }
+        if (result->median_ns > 0) {
+            result->mb_per_s = (double) bytes_per_op / result->median_ns * 1e9 / (1024.0 * 1024.0);
+        }
+    }
+
+    free(samples);
+    free(cycle_samples);
+    return 0;
+}
+
+void BenchPrintHeader(FILE *stream, const BenchFormat format) {
+    switch (format) {
+        case BENCH_FORMAT_TABLE:
+            fprintf(stream, "%-8s %-40s %12s %12s %12s %10s %10s  %s\n",
+                    "group", "name", "median ns", "p99 ns", "min ns", "cyc/byte", "MB/s", "counter");
+        break;
+        case BENCH_FORMAT_CSV:
+            fprintf(stream, "group,name,iterations,repetitions,bytes_per_op,median_ns,p99_ns,min_ns,mean_ns,"
+                            "cycles_per_byte,mb_per_s,counter_name,counter,second_counter_name,second_counter\n");
+        break;
+        case BENCH_FORMAT_JSON:
+        break;
+    }
+}
+
+void BenchPrintResult(FILE *stream, const BenchResult *result, const BenchFormat format) {
+    const char *counter_name = result->counter_name != NULL ? result->counter_name : "";
+    const char *second_counter_name = result->second_counter_name != NULL ? result->second_counter_name : "";
+    switch (format) {
+        case BENCH_FORMAT_TABLE:
+            fprintf(stream, "%-8s %-40s %12.2f %12.2f %12.2f %10.3f %10.1f  ",
+                    result->group, result->name, result->median_ns, result->p99_ns, result->min_ns,
+                    result->cycles_per_byte, result->mb_per_s);
+            if (result->counter_name != NULL) {
+                fprintf(stream, "%s=%.2f", counter_name, result->counter);
+            }
+            if (result->second_counter_name != NULL) {
+                fprintf(stream, " %s=%.2f", second_counter_name, result->second_counter);
+            }
+            fprintf(stream, "\n");
+        break;
+        case BENCH_FORMAT_CSV:
+            fprintf(stream, "%s,%s,%zu,%zu,%zu,%.3f,%.3f,%.3f,%.3f,%.4f,%.2f,%s,%.2f,%s,%.2f\n",
+                    result->group, result->name, result->iterations, result->repetitions, result->bytes_per_op,
+                    result->median_ns, result->p99_ns, result->min_ns, result->mean_ns,
+                    result->cycles_per_byte, result->mb_per_s, counter_name, result->counter,
+                    second_counter_name, result->second_counter);
+        break;
+        case BENCH_FORMAT_JSON:
+            fprintf(stream, "{\"group\":\"%s\",\"name\":\"%s\",\"iterations\":%zu,\"repetitions\":%zu,"
+                            "\"bytes_per_op\":%zu,\"median_ns\":%.3f,\"p99_ns\":%.3f,\"min_ns\":%.3f,"
+                            "\"mean_ns\":%.3f,\"cycles_per_byte\":%.4f,\"mb_per_s\":%.2f,"
+                            "\"counter_name\":\"%s\",\"counter\":%.2f,"
+                            "\"second_counter_name\":\"%s\",\"second_counter\":%.2f}\n",
+                    result->group, result->name, result->iterations, result->repetitions, result->bytes_per_op,
+                    result->median_ns, result->p99_ns, result->min_ns, result->mean_ns,
+                    result->cycles_per_byte, result->mb_per_s, counter_name, result->counter,
+                    second_counter_name, result->second_counter);
+        break;
+    }
+}
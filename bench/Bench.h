@@ -0,0 +1,114 @@
+/**
+ * @file    Bench.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Small micro-benchmark harness (warm-up, repetitions, median/p99, cycles per byte)
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * @brief               A benchmarked operation. It should perform the measured operation `iterations` times.
+ * @param context       User data passed to BenchRun
+ * @param iterations    How many times the operation should be performed
+ */
+typedef void (*BenchFunction)(void *context, size_t iterations);
+
+/**
+ * @brief               Output formats of the results. CSV and JSON are meant to be diffed between commits.
+ */
+typedef enum bench_format {
+    BENCH_FORMAT_TABLE,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+}BenchFormat;
+
+/**
+ * @brief               Controls how a benchmark is run.
+ */
+typedef struct BenchConfig {
+    size_t warmup_repetitions;      //Repetitions which are run but not recorded
+    size_t repetitions;             //Recorded repetitions, the median and p99 are taken over these
+    long long min_repetition_ns;    //Iterations per repetition are calibrated so a repetition takes at least this long
+}BenchConfig;
+
+/**
+ * @brief               Result of a benchmark. Timings are per operation.
+ */
+typedef struct BenchResult {
+    const char *group;              //The module under test (e.g. "string")
+    const char *name;               //Name of the case (e.g. "MemoryCopy/4096")
+    size_t iterations;              //Operations per repetition
+    size_t repetitions;             //Recorded repetitions
+    size_t bytes_per_op;            //Bytes processed per operation, 0 if not meaningful
+    double median_ns, p99_ns, min_ns, mean_ns;
+    double cycles_per_byte;         //Time stamp counter cycles per byte, negative if not available
+    double mb_per_s;                //Throughput based on the median, 0 if bytes_per_op is 0
+    const char *counter_name;       //Optional case specific counter, NULL if not used
+    double counter;
+    const char *second_counter_name;    //Optional second counter, NULL if not used
+    double second_counter;
+}BenchResult;
+
+/**
+ * @brief               Gets a monotonic timestamp.
+ * @return              Nanoseconds since an unspecified point
+ */
+long long BenchNowNanoseconds(void);
+
+/**
+ * @brief               Reads the time stamp counter (reference cycles, not core cycles).
+ * @return              The counter value, 0 if the platform has no such counter
+ */
+unsigned long long BenchCycles(void);
+
+/**
+ * @brief               Counts the hardware cache misses of running an operation, using perf events on Linux.
+ * @param function      The operation
+ * @param context       User data for the operation
+ * @param iterations    How many times the operation should be performed
+ * @return              The count of the misses, negative if the platform or the kernel provides no counter
+ */
+double BenchCountCacheMisses(BenchFunction function, void *context, size_t iterations);
+
+/**
+ * @brief               Prevents the compiler from optimising away the computation of a value.
+ * @param pointer       Address of the value
+ */
+void BenchDoNotOptimize(const void *pointer);
+
+/**
+ * @brief               Runs a benchmark: calibrates the iteration count, runs the warm-up repetitions and then
+ *                      records the recorded repetitions.
+ * @param result        Result to write to
+ * @param group         The module under test
+ * @param name          Name of the case
+ * @param function      The benchmarked operation
+ * @param context       User data for the operation
+ * @param bytes_per_op  Bytes processed per operation, 0 if not meaningful
+ * @param config        Run configuration
+ * @return              0 on success, 1 on failure
+ */
+int BenchRun(BenchResult *result, const char *group, const char *name, BenchFunction function, void *context,
+             size_t bytes_per_op, const BenchConfig *config);
+
+/**
+ * @brief               Prints the header of the given format (nothing for JSON lines).
+ * @param stream        Stream to print to
+ * @param format        Output format
+ */
+void BenchPrintHeader(FILE *stream, BenchFormat format);
+
+/**
+ * @brief               Prints a result in the given format.
+ * @param stream        Stream to print to
+ * @param result        Result to print
+ * @param format        Output format
+ */
+void BenchPrintResult(FILE *stream, const BenchResult *result, BenchFormat format);
+
+#endif //BENCH_H
@@ -0,0 +1,1134 @@
+/**
+ * @file    BenchMain.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Benchmark cases for the library's hot paths and their libc baselines
+ *
+ * Usage: clib_bench [--format=table|csv|json] [--filter=substring] [--repetitions=n] [--min-time-us=n]
+ */
+
+//fopencookie is used to count the write calls of the stdio baseline
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Bench.h"
+#include "../arena/Arena.h"
+#include "../gc/Collector.h"
+#include "../log/Log.h"
+#include "../log/LogSink.h"
+#include "../stack/Stack.h"
+#include "../string/CompactString.h"
+#include "../string/String.h"
+#include "../string/StringSort.h"
+#include "../string/Utf8.h"
+#include "../vector/Vector.h"
+
+#ifdef _WIN32
+    #define NULL_DEVICE "NUL"
+#else
+    #define NULL_DEVICE "/dev/null"
+#endif
+
+//Size of the buffers used by the memory benchmarks
+#define MEMORY_BENCH_SIZE 4096
+//Size of the arena shared by the arena and string benchmarks
+#define BENCH_ARENA_SIZE (16 * 1024 * 1024)
+
+/**
+ * @brief               A registered benchmark case
+ */
+typedef struct BenchCase {
+    const char *group;
+    const char *name;
+    BenchFunction function;
+    void *context;
+    size_t bytes_per_op;
+}BenchCase;
+
+// ===== Null Sink =====
+//The library logs on every arena allocation, the benchmarks keep that cost but discard the output
+static size_t null_sink_lines;
+
+static void NullSinkWrite(LogSink *sink, const char *data, size_t length) {
+    (void) sink;
+    null_sink_lines++;
+    BenchDoNotOptimize(data);
+    BenchDoNotOptimize(&length);
+}
+
+static void NullSinkFlush(LogSink *sink) {
+    (void) sink;
+}
+
+static LogSink null_sink = {NullSinkWrite, NullSinkFlush, NullSinkFlush, 0};
+// ===== Null Sink =====
+
+// ===== Arena Cases =====
+static void BenchArenaAllocate(void *context, const size_t iterations) {
+    Arena *arena = context;
+    for (size_t i = 0; i < iterations; i++) {
+        if (arena->offset + 16 > arena->size) {
+            FlushArena(arena);
+        }
+        void *pointer = ArenaAllocate(arena, 16);
+        BenchDoNotOptimize(pointer);
+    }
+}
+
+static void BenchMallocFree(void *context, const size_t iterations) {
+    (void) context;
+    for (size_t i = 0; i < iterations; i++) {
+        void *pointer = malloc(16);
+        BenchDoNotOptimize(pointer);
+        free(pointer);
+    }
+}
+// ===== Arena Cases =====
+
+// ===== Memory Cases =====
+typedef struct MemoryContext {
+    unsigned char *source;
+    unsigned char *destination;
+}MemoryContext;
+
+static void BenchMemoryCopy(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        MemoryCopy(memory->destination, memory->source, MEMORY_BENCH_SIZE);
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+
+static void BenchMemcpy(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memcpy(memory->destination, memory->source, MEMORY_BENCH_SIZE);
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+
+static void BenchMemorySet(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        MemorySet(memory->destination, (int) (i & 0xFF), MEMORY_BENCH_SIZE);
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+
+static void BenchMemset(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memset(memory->destination, (int) (i & 0xFF), MEMORY_BENCH_SIZE);
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+
+//Overlapping move in both directions so both of MemoryMove's paths are measured
+static void BenchMemoryMove(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        if (i & 1) {
+            MemoryMove(memory->destination, memory->destination + 64, MEMORY_BENCH_SIZE);
+        }
+        else {
+            MemoryMove(memory->destination + 64, memory->destination, MEMORY_BENCH_SIZE);
+        }
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+
+static void BenchMemmove(void *context, const size_t iterations) {
+    const MemoryContext *memory = context;
+    for (size_t i = 0; i < iterations; i++) {
+        if (i & 1) {
+            memmove(memory->destination, memory->destination + 64, MEMORY_BENCH_SIZE);
+        }
+        else {
+            memmove(memory->destination + 64, memory->destination, MEMORY_BENCH_SIZE);
+        }
+        BenchDoNotOptimize(memory->destination);
+    }
+}
+// ===== Memory Cases =====
+
+// ===== String Cases =====
+typedef struct StringContext {
+    Arena *arena;
+    size_t reset_offset;        //Offset of the arena after the fixtures were allocated
+    String *text;               //Delimited text for the tokenizer
+    String *left, *right;       //Equal strings for the comparison
+    String *suffix;             //Short string for appending
+    char *scratch;              //Writable copy of the text for strtok
+}StringContext;
+
+//Drops everything allocated after the fixtures once the arena is close to full, returns 1 if it did
+static int StringContextReclaim(StringContext *string, const size_t needed) {
+    if (string->arena->offset + needed > string->arena->size) {
+        string->arena->offset = string->reset_offset;
+        return 1;
+    }
+    return 0;
+}
+
+static void BenchStringTokenize(void *context, const size_t iterations) {
+    StringContext *string = context;
+    for (size_t i = 0; i < iterations; i++) {
+        //Tokens, their headers and the result array fit in a few times the text length
+        StringContextReclaim(string, string->text->length * 8 + 4096);
+        String **tokens = StringTokenize(string->arena, string->text, ' ');
+        BenchDoNotOptimize(tokens);
+    }
+}
+
+static void BenchStrtok(void *context, const size_t iterations) {
+    const StringContext *string = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memcpy(string->scratch, string->text->c_str, string->text->length + 1);
+        char *state = NULL;
+        for (char *token = strtok_r(string->scratch, " ", &state); token != NULL;
+             token = strtok_r(NULL, " ", &state)) {
+            BenchDoNotOptimize(token);
+        }
+    }
+}
+
+static void BenchAppendString(void *context, const size_t iterations) {
+    StringContext *string = context;
+    String target = {"", 0};
+    for (size_t i = 0; i < iterations; i++) {
+        //Keep the appended string short so every operation costs about the same.
+        //It is also reset when the arena is reclaimed as its data is gone.
+        if (StringContextReclaim(string, 512) || target.length >= 256) {
+            target.c_str = "";
+            target.length = 0;
+        }
+        AppendString(string->arena, &target, string->suffix);
+        BenchDoNotOptimize(target.c_str);
+    }
+}
+
+static void BenchStringCompare(void *context, const size_t iterations) {
+    const StringContext *string = context;
+    for (size_t i = 0; i < iterations; i++) {
+        int result = StringCompare(string->left, string->right);
+        BenchDoNotOptimize(&result);
+    }
+}
+
+static void BenchMemcmp(void *context, const size_t iterations) {
+    const StringContext *string = context;
+    for (size_t i = 0; i < iterations; i++) {
+        int result = string->left->length != string->right->length ||
+                     memcmp(string->left->c_str, string->right->c_str, string->left->length) != 0;
+        BenchDoNotOptimize(&result);
+    }
+}
+// ===== String Cases =====
+
+// ===== Compact String Cases =====
+#define COMPACT_BENCH_TOKENS 65536
+
+//Token lists of both layouts, built from the same text
+typedef struct CompactContext {
+    Arena *arena;                   //Arena of the tokenize cases, flushed before every operation
+    Arena *fixture_arena;           //Arena of the text and of the token lists of the other cases
+    String *text;
+    CompactString *compact_text;
+    String **tokens;
+    CompactString *compact_tokens;
+    size_t token_count;
+}CompactContext;
+
+//A case with the counters it reports, which are measured once when the fixtures are built
+typedef struct CompactCase {
+    CompactContext *compact;
+    const char *counter_name;
+    double counter;
+    const char *second_counter_name;
+    double second_counter;
+}CompactCase;
+
+static void BenchStringTokenizeTokens(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        FlushArena(compact->arena);
+        String **tokens = StringTokenize(compact->arena, compact->text, ' ');
+        BenchDoNotOptimize(tokens);
+    }
+}
+
+static void BenchCompactStringTokenize(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        FlushArena(compact->arena);
+        size_t count;
+        CompactString *tokens = CompactStringTokenize(compact->arena, compact->compact_text, ' ', &count);
+        BenchDoNotOptimize(tokens);
+    }
+}
+
+//One operation reads every character of every token through its view, the access pattern of a token consumer
+static void BenchStringTokenScan(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        size_t hash = 0;
+        for (size_t t = 0; t < compact->token_count; t++) {
+            const StringView view = StringGetView(compact->tokens[t]);
+            for (size_t c = 0; c < view.length; c++) {
+                hash = hash * 31 + (unsigned char) view.data[c];
+            }
+        }
+        BenchDoNotOptimize(&hash);
+    }
+}
+
+static void BenchCompactStringTokenScan(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        size_t hash = 0;
+        for (size_t t = 0; t < compact->token_count; t++) {
+            const StringView view = CompactStringGetView(&compact->compact_tokens[t]);
+            for (size_t c = 0; c < view.length; c++) {
+                hash = hash * 31 + (unsigned char) view.data[c];
+            }
+        }
+        BenchDoNotOptimize(&hash);
+    }
+}
+
+//One operation compares every token with the next one, the access pattern of deduplication
+static void BenchStringTokenCompare(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        size_t equal = 0;
+        for (size_t t = 1; t < compact->token_count; t++) {
+            equal += StringCompare(compact->tokens[t - 1], compact->tokens[t]) == 0;
+        }
+        BenchDoNotOptimize(&equal);
+    }
+}
+
+static void BenchCompactStringTokenCompare(void *context, const size_t iterations) {
+    const CompactCase *compact_case = context;
+    const CompactContext *compact = compact_case->compact;
+    for (size_t i = 0; i < iterations; i++) {
+        size_t equal = 0;
+        for (size_t t = 1; t < compact->token_count; t++) {
+            equal += CompactStringCompare(&compact->compact_tokens[t - 1], &compact->compact_tokens[t]) == 0;
+        }
+        BenchDoNotOptimize(&equal);
+    }
+}
+
+//Records the cache lines of a byte range
+static void AddCacheLines(size_t *lines, size_t *line_count, const void *start, const size_t size) {
+    const size_t first = (size_t) (uintptr_t) start / 64;
+    const size_t last = ((size_t) (uintptr_t) start + (size > 0 ? size - 1 : 0)) / 64;
+    for (size_t line = first; line <= last; line++) {
+        lines[(*line_count)++] = line;
+    }
+}
+
+static int CompareLines(const void *first, const void *second) {
+    const size_t x = *(const size_t *) first;
+    const size_t y = *(const size_t *) second;
+    return (x > y) - (x < y);
+}
+
+//Distinct cache lines a token scan of either layout touches per token: the array slot, the header (String only)
+//and the characters (inline compact strings have none outside the slot). Used where no miss counter is available.
+static double CountScanLines(const CompactContext *compact, const int compact_layout) {
+    size_t *lines = malloc(compact->token_count * 8 * sizeof(size_t));
+    if (lines == NULL) {
+        return -1;
+    }
+    size_t line_count = 0;
+    for (size_t t = 0; t < compact->token_count; t++) {
+        if (compact_layout) {
+            const CompactString *token = &compact->compact_tokens[t];
+            AddCacheLines(lines, &line_count, token, sizeof(CompactString));
+            if (token->length > COMPACT_STRING_INLINE_CAPACITY) {
+                AddCacheLines(lines, &line_count, token->data, token->length);
+            }
+        }
+        else {
+            const String *token = compact->tokens[t];
+            AddCacheLines(lines, &line_count, &compact->tokens[t], sizeof(String *));
+            AddCacheLines(lines, &line_count, token, sizeof(String));
+            AddCacheLines(lines, &line_count, token->c_str, token->length);
+        }
+    }
+    qsort(lines, line_count, sizeof(size_t), CompareLines);
+    size_t distinct = line_count > 0 ? 1 : 0;
+    for (size_t i = 1; i < line_count; i++) {
+        distinct += lines[i] != lines[i - 1];
+    }
+    free(lines);
+    return (double) distinct / (double) compact->token_count;
+}
+
+//Sets the counter of a scan case to its cache misses per token. Without a miss counter it is set to the distinct
+//cache lines per token instead, named as an estimate: it bounds the misses of a cold scan but is not a measurement.
+static void MeasureScan(CompactCase *compact_case, const BenchFunction function, const int compact_layout) {
+    const double misses = BenchCountCacheMisses(function, compact_case, 1);
+    if (misses >= 0) {
+        compact_case->counter_name = "cache_misses_per_token";
+        compact_case->counter = misses / (double) compact_case->compact->token_count;
+        return;
+    }
+    compact_case->counter_name = "estimated_lines_per_token";
+    compact_case->counter = CountScanLines(compact_case->compact, compact_layout);
+}
+
+//Sets the counters of a tokenize case to the arena bytes its result takes per token and to the arena calls it
+//makes per token. Every arena call logs a line, so the calls rather than the layout dominate the timings.
+static void MeasureTokenize(CompactCase *compact_case, const BenchFunction function) {
+    const size_t lines = null_sink_lines;
+    function(compact_case, 1);
+    compact_case->counter_name = "bytes_per_token";
+    compact_case->counter = (double) compact_case->compact->arena->offset /
+                            (double) compact_case->compact->token_count;
+    compact_case->second_counter_name = "arena_calls_per_token";
+    compact_case->second_counter = (double) (null_sink_lines - lines) /
+                                   (double) compact_case->compact->token_count;
+}
+
+//Builds COMPACT_BENCH_TOKENS space separated tokens, four fifths of them 3 to 15 bytes long and the rest 16 to 40
+//bytes long, and tokenises them once into each layout for the scan and compare cases
+static int CompactContextInit(CompactContext *compact) {
+    compact->arena = CreateArena(16 * 1024 * 1024);
+    compact->fixture_arena = CreateArena(16 * 1024 * 1024);
+    char *text = malloc(COMPACT_BENCH_TOKENS * 41);
+    if (compact->arena == NULL || compact->fixture_arena == NULL || text == NULL) {
+        free(text);
+        return 1;
+    }
+
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    size_t length = 0;
+    for (size_t i = 0; i < COMPACT_BENCH_TOKENS; i++) {
+        //xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const size_t token_length = state % 5 != 0 ? 3 + (size_t) (state >> 8) % 13 : 16 + (size_t) (state >> 8) % 25;
+        for (size_t j = 0; j < token_length; j++) {
+            text[length++] = (char) ('a' + (state >> (j * 3 % 56)) % 26);
+        }
+        text[length++] = ' ';
+    }
+    text[length - 1] = '\0';
+
+    compact->text = StringCreate(compact->fixture_arena, text);
+    compact->compact_text = CompactStringCreate(compact->fixture_arena, text);
+    free(text);
+    compact->tokens = StringTokenize(compact->fixture_arena, compact->text, ' ');
+    compact->compact_tokens = CompactStringTokenize(compact->fixture_arena, compact->compact_text, ' ',
+                                                    &compact->token_count);
+    return compact->text == NULL || compact->compact_text == NULL || compact->tokens == NULL ||
+           compact->compact_tokens == NULL;
+}
+// ===== Compact String Cases =====
+
+// ===== UTF-8 Cases =====
+#define UTF8_BENCH_SIZE (64 * 1024)
+#define UTF8_FOLD_BENCH_SIZE 4096
+
+typedef struct Utf8Context {
+    Arena *arena;
+    String ascii;               //ASCII text
+    String mixed;               //Latin, Greek, Cyrillic, CJK and emoji text
+    String fold;                //Null terminated copy of the mixed text's first UTF8_FOLD_BENCH_SIZE bytes at most
+}Utf8Context;
+
+static void BenchUtf8IsValidAscii(void *context, const size_t iterations) {
+    const Utf8Context *utf8 = context;
+    for (size_t i = 0; i < iterations; i++) {
+        int valid = Utf8IsValid(utf8->ascii.c_str, utf8->ascii.length);
+        BenchDoNotOptimize(&valid);
+    }
+}
+
+static void BenchUtf8IsValidMixed(void *context, const size_t iterations) {
+    const Utf8Context *utf8 = context;
+    for (size_t i = 0; i < iterations; i++) {
+        int valid = Utf8IsValid(utf8->mixed.c_str, utf8->mixed.length);
+        BenchDoNotOptimize(&valid);
+    }
+}
+
+static void BenchUtf8CountCodePoints(void *context, const size_t iterations) {
+    const Utf8Context *utf8 = context;
+    for (size_t i = 0; i < iterations; i++) {
+        size_t count = Utf8CountCodePoints(utf8->mixed.c_str, utf8->mixed.length);
+        BenchDoNotOptimize(&count);
+    }
+}
+
+static void BenchStringCaseFold(void *context, const size_t iterations) {
+    const Utf8Context *utf8 = context;
+    for (size_t i = 0; i < iterations; i++) {
+        FlushArena(utf8->arena);
+        String *folded = StringCaseFold(utf8->arena, &utf8->fold);
+        BenchDoNotOptimize(folded);
+    }
+}
+
+//ASCII only lower casing of the same bytes, the cost of the old path for comparison
+static void BenchStringToLower(void *context, const size_t iterations) {
+    const Utf8Context *utf8 = context;
+    for (size_t i = 0; i < iterations; i++) {
+        FlushArena(utf8->arena);
+        String *copy = StringCreate(utf8->arena, utf8->fold.c_str);
+        StringToLower(copy);
+        BenchDoNotOptimize(copy);
+    }
+}
+
+//Fills the buffer with repetitions of the sample text, cut on a code point boundary, and null terminates it
+static size_t FillUtf8Text(char *buffer, const size_t size, const char *sample) {
+    const size_t sample_length = strlen(sample);
+    size_t length = 0;
+    while (length + sample_length < size) {
+        memcpy(buffer + length, sample, sample_length);
+        length += sample_length;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+// ===== UTF-8 Cases =====
+
+// ===== Sort Cases =====
+#define SORT_BENCH_COUNT 100000
+#define SORT_BENCH_TOKEN_SIZE 24
+
+typedef struct SortContext {
+    Arena *arena;               //Scratch space of the sorts
+    char *text;                 //Storage of the tokens
+    StringView *source;         //The tokens in their original order
+    StringView *views;          //Copy of the source which is sorted
+    String *strings;            //String objects of the tokens
+    String **source_strings;
+    String **sorted_strings;
+    size_t count;
+    size_t bytes;               //Total length of the tokens
+    StringSortOptions options;
+}SortContext;
+
+static void BenchStringViewSort(void *context, const size_t iterations) {
+    SortContext *sort = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memcpy(sort->views, sort->source, sort->count * sizeof(StringView));
+        StringViewSort(sort->arena, sort->views, sort->count, &sort->options);
+        BenchDoNotOptimize(sort->views);
+    }
+}
+
+static void BenchStringSort(void *context, const size_t iterations) {
+    SortContext *sort = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memcpy(sort->sorted_strings, sort->source_strings, sort->count * sizeof(String *));
+        StringSort(sort->arena, sort->sorted_strings, sort->count, &sort->options);
+        BenchDoNotOptimize(sort->sorted_strings);
+    }
+}
+
+static int CompareViews(const void *first, const void *second) {
+    return StringViewCompareOrdered(*(const StringView *) first, *(const StringView *) second);
+}
+
+static void BenchQsortViews(void *context, const size_t iterations) {
+    SortContext *sort = context;
+    for (size_t i = 0; i < iterations; i++) {
+        memcpy(sort->views, sort->source, sort->count * sizeof(StringView));
+        qsort(sort->views, sort->count, sizeof(StringView), CompareViews);
+        BenchDoNotOptimize(sort->views);
+    }
+}
+
+//Creates SORT_BENCH_COUNT pseudo random tokens: a third are lower case words of 4 to 11 letters, the rest are
+//16 byte paths which share long prefixes, the case the cached prefixes are for
+static int SortContextInit(SortContext *sort) {
+    sort->count = SORT_BENCH_COUNT;
+    sort->bytes = 0;
+    sort->arena = CreateArena(2 * SORT_BENCH_COUNT * 32 + 4096);
+    sort->text = malloc((size_t) SORT_BENCH_COUNT * SORT_BENCH_TOKEN_SIZE);
+    sort->source = malloc(SORT_BENCH_COUNT * sizeof(StringView));
+    sort->views = malloc(SORT_BENCH_COUNT * sizeof(StringView));
+    sort->strings = malloc(SORT_BENCH_COUNT * sizeof(String));
+    sort->source_strings = malloc(SORT_BENCH_COUNT * sizeof(String *));
+    sort->sorted_strings = malloc(SORT_BENCH_COUNT * sizeof(String *));
+    if (sort->arena == NULL || sort->text == NULL || sort->source == NULL || sort->views == NULL ||
+        sort->strings == NULL || sort->source_strings == NULL || sort->sorted_strings == NULL) {
+        return 1;
+    }
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < SORT_BENCH_COUNT; i++) {
+        char *token = sort->text + i * SORT_BENCH_TOKEN_SIZE;
+        //xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t length;
+        if (state % 3 == 0) {
+            length = 4 + (size_t) (state >> 8) % 8;
+            for (size_t j = 0; j < length; j++) {
+                token[j] = (char) ('a' + (state >> (j * 5 % 48)) % 26);
+            }
+        }
+        else {
+            length = (size_t) snprintf(token, SORT_BENCH_TOKEN_SIZE, "/usr/lib/%c/%05u",
+                                       (char) ('a' + (state >> 16) % 4), (unsigned) ((state >> 24) % 100000));
+        }
+        token[length] = '\0';
+        sort->source[i].data = token;
+        sort->source[i].length = length;
+        sort->strings[i].c_str = token;
+        sort->strings[i].length = length;
+        sort->source_strings[i] = &sort->strings[i];
+        sort->bytes += length;
+    }
+    return 0;
+}
+
+static void SortContextFree(SortContext *sort) {
+    free(sort->text);
+    free(sort->source);
+    free(sort->views);
+    free(sort->strings);
+    free(sort->source_strings);
+    free(sort->sorted_strings);
+    if (sort->arena != NULL) {
+        DestroyArena(sort->arena);
+    }
+}
+// ===== Sort Cases =====
+
+// ===== Stack Cases =====
+#define STACK_BENCH_DEPTH 1024
+
+//One operation is a push followed by a pop, the stack is filled and drained in batches of STACK_BENCH_DEPTH
+static void BenchStackPushPop(void *context, const size_t iterations) {
+    Stack *stack = context;
+    size_t done = 0;
+    while (done < iterations) {
+        size_t batch = iterations - done;
+        if (batch > STACK_BENCH_DEPTH) {
+            batch = STACK_BENCH_DEPTH;
+        }
+        for (size_t i = 0; i < batch; i++) {
+            StackPush(stack, (void *) (i + 1));
+        }
+        for (size_t i = 0; i < batch; i++) {
+            void *item = StackPop(stack);
+            BenchDoNotOptimize(item);
+        }
+        done += batch;
+    }
+}
+// ===== Stack Cases =====
+
+// ===== Vector Cases =====
+VECTOR_DECLARE(SizeVector, size_t)
+VECTOR_DEFINE(SizeVector, size_t)
+
+#define VECTOR_BENCH_LENGTH 4096
+
+//One operation fills a fresh vector with VECTOR_BENCH_LENGTH elements, starting from no capacity
+static void BenchVectorPush(void *context, const size_t iterations) {
+    Arena *arena = context;
+    for (size_t i = 0; i < iterations; i++) {
+        if (arena != NULL) {
+            FlushArena(arena);
+        }
+        SizeVector vector;
+        SizeVectorInit(&vector, arena, 0);
+        for (size_t j = 0; j < VECTOR_BENCH_LENGTH; j++) {
+            SizeVectorPush(&vector, j);
+        }
+        BenchDoNotOptimize(vector.data);
+        SizeVectorFree(&vector);
+    }
+}
+
+//Pointer element types instantiate the by-value parameters as `String *`, which must not become `const String *`
+VECTOR_DECLARE(StringVector, String *)
+VECTOR_DEFINE(StringVector, String *)
+
+#define VECTOR_BENCH_STRINGS 64
+
+//One operation fills a fresh vector with VECTOR_BENCH_LENGTH pointers, inserts one at the front and swap-removes it
+static void BenchStringVectorPush(void *context, const size_t iterations) {
+    Arena *arena = context;
+    static String strings[VECTOR_BENCH_STRINGS];
+    for (size_t i = 0; i < iterations; i++) {
+        if (arena != NULL) {
+            FlushArena(arena);
+        }
+        StringVector vector;
+        StringVectorInit(&vector, arena, 0);
+        for (size_t j = 0; j < VECTOR_BENCH_LENGTH; j++) {
+            StringVectorPush(&vector, &strings[j % VECTOR_BENCH_STRINGS]);
+        }
+        StringVectorInsert(&vector, 0, &strings[0]);
+        String *removed = NULL;
+        StringVectorSwapRemove(&vector, 0, &removed);
+        BenchDoNotOptimize(removed);
+        BenchDoNotOptimize(vector.data);
+        StringVectorFree(&vector);
+    }
+}
+// ===== Vector Cases =====
+
+// ===== Collector Cases =====
+#define COLLECTOR_BENCH_LIVE 1024
+
+typedef struct CollectorNode {
+    struct CollectorNode *next;
+    size_t value;
+}CollectorNode;
+
+typedef struct CollectorContext {
+    Collector *collector;
+    int node_type;
+    CollectorNode *list;        //Root, a list of COLLECTOR_BENCH_LIVE nodes which is rebuilt continuously
+    size_t built;
+    size_t failed_allocations;
+}CollectorContext;
+
+static void TraceCollectorNode(Collector *collector, void *object) {
+    CollectorMark(collector, ((CollectorNode *) object)->next);
+}
+
+//One operation allocates a list node and a 48 byte leaf, the list is dropped every COLLECTOR_BENCH_LIVE nodes
+static void BenchCollectorAllocate(void *context, const size_t iterations) {
+    CollectorContext *gc = context;
+    for (size_t i = 0; i < iterations; i++) {
+        if (gc->built++ == COLLECTOR_BENCH_LIVE) {
+            gc->list = NULL;
+            gc->built = 0;
+        }
+        CollectorNode *node = CollectorAllocate(gc->collector, sizeof(CollectorNode), gc->node_type);
+        node->value = i;
+        CollectorWriteBarrier(gc->collector, (void **) &node->next, gc->list);
+        gc->list = node;
+        void *leaf = CollectorAllocate(gc->collector, 48, COLLECTOR_TYPE_LEAF);
+        BenchDoNotOptimize(leaf);
+    }
+}
+
+//Size of the live data of a phase of BenchCollectorSwitch, a little more than half of its heap
+#define COLLECTOR_SWITCH_LIVE (2 * 1024 * 1024)
+#define COLLECTOR_SWITCH_HEAP (4 * 1024 * 1024)
+#define COLLECTOR_SWITCH_LARGE_SIZE 10000
+
+//One operation is a phase which drops the list and rebuilds COLLECTOR_SWITCH_LIVE bytes of it, phases alternate
+//between small nodes and large ones. The heap only holds both kinds at once if the pages freed by one kind are
+//reused by the other, any failure is counted.
+static void BenchCollectorSwitch(void *context, const size_t iterations) {
+    CollectorContext *gc = context;
+    for (size_t i = 0; i < iterations; i++) {
+        const size_t size = gc->built++ % 2 == 0 ? sizeof(CollectorNode) : COLLECTOR_SWITCH_LARGE_SIZE;
+        gc->list = NULL;
+        for (size_t live = 0; live < COLLECTOR_SWITCH_LIVE; live += size) {
+            CollectorNode *node = CollectorAllocate(gc->collector, size, gc->node_type);
+            if (node == NULL) {
+                gc->failed_allocations++;
+                break;
+            }
+            CollectorWriteBarrier(gc->collector, (void **) &node->next, gc->list);
+            gc->list = node;
+        }
+    }
+}
+
+static int CollectorContextInit(CollectorContext *gc, const size_t heap_size, const long long step_budget_ns) {
+    const CollectorOptions options = {heap_size, 1024 * 1024, step_budget_ns};
+    gc->collector = CollectorCreate(&options);
+    gc->list = NULL;
+    gc->built = 0;
+    gc->failed_allocations = 0;
+    if (gc->collector == NULL) {
+        return 1;
+    }
+    gc->node_type = CollectorRegisterType(gc->collector, TraceCollectorNode);
+    return CollectorAddRoot(gc->collector, (void **) &gc->list);
+}
+// ===== Collector Cases =====
+
+// ===== Log Cases =====
+#ifdef __GLIBC__
+    #define LOG_BENCH_COUNTS_WRITES 1
+#else
+    #define LOG_BENCH_COUNTS_WRITES 0
+#endif
+
+#define LOG_BENCH_MESSAGE "Arena at 0x7f0000001000 allocated 16 bytes to 0x7f0000002000 (requested 16)\n"
+
+typedef struct LogContext {
+    LogSink *sink;              //Sink for the sink based cases, NULL for the stdio baseline
+    FILE *stream;               //Stream for the stdio baseline and the console sink
+    size_t lines;               //Lines logged so far
+    size_t writes;              //Write calls issued by the stream, only counted if LOG_BENCH_COUNTS_WRITES
+}LogContext;
+
+//Number of write calls a case issued to the OS, or -1 if they cannot be counted on this platform
+static double LogContextWrites(const LogContext *log, const LogSink *file_sink) {
+    if (log->sink != NULL && log->sink == file_sink) {
+        return (double) ((const FileSink *) file_sink)->flush_count;
+    }
+#if LOG_BENCH_COUNTS_WRITES
+    return (double) log->writes;
+#else
+    return -1;
+#endif
+}
+
+//The logger as it was before sinks: the line is formatted straight into a stdio stream
+static void BenchLogPrintf(void *context, const size_t iterations) {
+    LogContext *log = context;
+    for (size_t i = 0; i < iterations; i++) {
+        char timestamp[128];
+        GetTimestamp(timestamp, sizeof(timestamp));
+        fprintf(log->stream, "%s %s: %s", timestamp, "\x1b[30;46m[INFO]\x1b[0m", LOG_BENCH_MESSAGE);
+    }
+    log->lines += iterations;
+}
+
+//The case's sink is made active by main around the whole run, switching it here would flush it every repetition
+static void BenchLogSink(void *context, const size_t iterations) {
+    LogContext *log = context;
+    for (size_t i = 0; i < iterations; i++) {
+        Log(INFO, LOG_BENCH_MESSAGE);
+    }
+    log->lines += iterations;
+}
+
+#if LOG_BENCH_COUNTS_WRITES
+static ssize_t CountingWrite(void *cookie, const char *data, size_t size) {
+    LogContext *log = cookie;
+    log->writes++;
+    BenchDoNotOptimize(data);
+    return (ssize_t) size;
+}
+
+//A stream which discards its output but counts the write calls stdio would have issued
+static FILE *OpenCountingStream(LogContext *log, const int mode) {
+    const cookie_io_functions_t functions = {NULL, CountingWrite, NULL, NULL};
+    FILE *stream = fopencookie(log, "w", functions);
+    if (stream != NULL) {
+        setvbuf(stream, NULL, mode, BUFSIZ);
+    }
+    return stream;
+}
+#else
+static FILE *OpenCountingStream(LogContext *log, const int mode) {
+    (void) log;
+    FILE *stream = fopen(NULL_DEVICE, "w");
+    if (stream != NULL) {
+        setvbuf(stream, NULL, mode, BUFSIZ);
+    }
+    return stream;
+}
+#endif
+// ===== Log Cases =====
+
+static void PrintUsage(const char *program) {
+    fprintf(stderr, "Usage: %s [--format=table|csv|json] [--filter=substring] [--repetitions=n] [--min-time-us=n]\n",
+            program);
+}
+
+int main(int argc, char **argv) {
+    BenchFormat format = BENCH_FORMAT_TABLE;
+    const char *filter = NULL;
+    BenchConfig config = {5, 101, 1000000};
+
+    //Parse the arguments
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--format=table") == 0) {
+            format = BENCH_FORMAT_TABLE;
+        }
+        else if (strcmp(argv[i], "--format=csv") == 0) {
+            format = BENCH_FORMAT_CSV;
+        }
+        else if (strcmp(argv[i], "--format=json") == 0) {
+            format = BENCH_FORMAT_JSON;
+        }
+        else if (strncmp(argv[i], "--filter=", 9) == 0) {
+            filter = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--repetitions=", 14) == 0) {
+            config.repetitions = strtoul(argv[i] + 14, NULL, 10);
+        }
+        else if (strncmp(argv[i], "--min-time-us=", 14) == 0) {
+            config.min_repetition_ns = strtoll(argv[i] + 14, NULL, 10) * 1000;
+        }
+        else {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (config.repetitions == 0) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    //Keep the library's own logging out of the results
+    LogSetSink(&null_sink);
+
+    //Arena fixtures
+    Arena *arena = CreateArena(BENCH_ARENA_SIZE);
+
+    //Memory fixtures, the destination has room for the overlapping moves
+    MemoryContext memory = {malloc(MEMORY_BENCH_SIZE), malloc(MEMORY_BENCH_SIZE + 64)};
+    for (size_t i = 0; i < MEMORY_BENCH_SIZE; i++) {
+        memory.source[i] = (unsigned char) i;
+    }
+    memset(memory.destination, 0, MEMORY_BENCH_SIZE + 64);
+
+    //String fixtures: 64 space separated tokens of 7 characters
+    Arena *string_arena = CreateArena(BENCH_ARENA_SIZE);
+    char text[64 * 8 + 1];
+    for (size_t i = 0; i < 64; i++) {
+        for (size_t j = 0; j < 7; j++) {
+            text[i * 8 + j] = (char) ('a' + (i + j) % 26);
+        }
+        text[i * 8 + 7] = ' ';
+    }
+    text[64 * 8 - 1] = '\0';
+    char long_text[257];
+    memset(long_text, 'x', 256);
+    long_text[256] = '\0';
+
+    StringContext string;
+    string.arena = string_arena;
+    string.text = StringCreate(string_arena, text);
+    string.left = StringCreate(string_arena, long_text);
+    string.right = StringCreate(string_arena, long_text);
+    string.suffix = StringCreate(string_arena, "token-16-bytes!!");
+    string.scratch = malloc(sizeof text);
+    string.reset_offset = string_arena->offset;
+
+    //Vector fixtures
+    Arena *vector_arena = CreateArena(BENCH_ARENA_SIZE);
+
+    //Compact string fixtures
+    CompactContext compact;
+    const int compact_failed = CompactContextInit(&compact);
+
+    //UTF-8 fixtures
+    Utf8Context utf8;
+    utf8.arena = CreateArena(4 * UTF8_FOLD_BENCH_SIZE);
+    utf8.ascii.c_str = malloc(UTF8_BENCH_SIZE + 1);
+    utf8.mixed.c_str = malloc(UTF8_BENCH_SIZE + 1);
+    utf8.fold.c_str = malloc(UTF8_FOLD_BENCH_SIZE + 1);
+    if (utf8.ascii.c_str != NULL && utf8.mixed.c_str != NULL && utf8.fold.c_str != NULL) {
+        utf8.ascii.length = FillUtf8Text(utf8.ascii.c_str, UTF8_BENCH_SIZE,
+                                         "The Quick Brown Fox Jumps Over The Lazy Dog. ");
+        utf8.mixed.length = FillUtf8Text(utf8.mixed.c_str, UTF8_BENCH_SIZE,
+                                         "Grüße aus Köln, ΚΑΛΗΜΈΡΑ κόσμε, Привет МИР, 日本語のテキスト, 😀🎉 ok. ");
+        //Cut before the last code point starting in the first UTF8_FOLD_BENCH_SIZE bytes
+        utf8.fold.length = Utf8GetByteOffset(utf8.mixed.c_str, utf8.mixed.length,
+                                             Utf8CountCodePoints(utf8.mixed.c_str, UTF8_FOLD_BENCH_SIZE) - 1);
+        memcpy(utf8.fold.c_str, utf8.mixed.c_str, utf8.fold.length);
+        utf8.fold.c_str[utf8.fold.length] = '\0';
+    }
+
+    //Sort fixtures, the serial cases never use the parallel mode
+    SortContext sort_serial, sort_parallel;
+    const int sort_failed = SortContextInit(&sort_serial);
+    sort_serial.options.thread_count = 1;
+    sort_serial.options.parallel_threshold = 0;
+    sort_parallel = sort_serial;
+    sort_parallel.options.thread_count = 0;
+
+    //Collector fixtures
+    CollectorContext gc_stop_the_world, gc_incremental, gc_switch;
+    const int gc_failed = CollectorContextInit(&gc_stop_the_world, 16 * 1024 * 1024, 0) |
+                          CollectorContextInit(&gc_incremental, 16 * 1024 * 1024, 50000) |
+                          CollectorContextInit(&gc_switch, COLLECTOR_SWITCH_HEAP, 0);
+
+    //Stack fixtures
+    Stack *stack = StackCreate(STACK_BENCH_DEPTH);
+
+    //Log fixtures
+    LogContext log_line_buffered = {NULL, NULL, 0, 0};
+    LogContext log_fully_buffered = {NULL, NULL, 0, 0};
+    LogContext log_console = {NULL, NULL, 0, 0};
+    LogContext log_file = {NULL, NULL, 0, 0};
+    log_line_buffered.stream = OpenCountingStream(&log_line_buffered, _IOLBF);
+    log_fully_buffered.stream = OpenCountingStream(&log_fully_buffered, _IOFBF);
+    log_console.stream = OpenCountingStream(&log_console, _IOFBF);
+    log_console.sink = ConsoleSinkCreate(log_console.stream);
+    log_file.sink = FileSinkCreate(NULL_DEVICE, NULL);
+    const size_t log_line_length = 32 + sizeof(LOG_BENCH_MESSAGE) - 1;
+
+    if (arena == NULL || memory.source == NULL || memory.destination == NULL || string.scratch == NULL ||
+        stack == NULL || vector_arena == NULL || utf8.arena == NULL || utf8.ascii.c_str == NULL ||
+        utf8.mixed.c_str == NULL || utf8.fold.c_str == NULL || compact_failed || sort_failed || gc_failed || log_line_buffered.stream == NULL ||
+        log_fully_buffered.stream == NULL || log_console.sink == NULL || log_file.sink == NULL) {
+        fprintf(stderr, "Cannot create the benchmark fixtures\n");
+        return 1;
+    }
+
+    //Compact string counters are measured on one run of each case
+    CompactCase string_tokenize = {&compact, NULL, 0, NULL, 0}, compact_tokenize = {&compact, NULL, 0, NULL, 0};
+    CompactCase string_scan = {&compact, NULL, 0, NULL, 0}, compact_scan = {&compact, NULL, 0, NULL, 0};
+    CompactCase string_compare = {&compact, NULL, 0, NULL, 0}, compact_compare = {&compact, NULL, 0, NULL, 0};
+    MeasureTokenize(&string_tokenize, BenchStringTokenizeTokens);
+    MeasureTokenize(&compact_tokenize, BenchCompactStringTokenize);
+    MeasureScan(&string_scan, BenchStringTokenScan, 0);
+    MeasureScan(&compact_scan, BenchCompactStringTokenScan, 1);
+
+    const BenchCase cases[] = {
+        {"arena", "ArenaAllocate/16", BenchArenaAllocate, arena, 16},
+        {"arena", "baseline/malloc+free/16", BenchMallocFree, NULL, 16},
+        {"memory", "MemoryCopy/4096", BenchMemoryCopy, &memory, MEMORY_BENCH_SIZE},
+        {"memory", "baseline/memcpy/4096", BenchMemcpy, &memory, MEMORY_BENCH_SIZE},
+        {"memory", "MemorySet/4096", BenchMemorySet, &memory, MEMORY_BENCH_SIZE},
+        {"memory", "baseline/memset/4096", BenchMemset, &memory, MEMORY_BENCH_SIZE},
+        {"memory", "MemoryMove/4096/overlap", BenchMemoryMove, &memory, MEMORY_BENCH_SIZE},
+        {"memory", "baseline/memmove/4096/overlap", BenchMemmove, &memory, MEMORY_BENCH_SIZE},
+        {"string", "StringTokenize/64x7", BenchStringTokenize, &string, sizeof text - 1},
+        {"string", "baseline/strtok_r/64x7", BenchStrtok, &string, sizeof text - 1},
+        {"string", "AppendString/16", BenchAppendString, &string, 16},
+        {"string", "StringCompare/256/equal", BenchStringCompare, &string, 256},
+        {"string", "baseline/memcmp/256/equal", BenchMemcmp, &string, 256},
+        {"compact", "StringTokenize/64k-tokens", BenchStringTokenizeTokens, &string_tokenize, compact.text->length},
+        {"compact", "CompactStringTokenize/64k-tokens", BenchCompactStringTokenize, &compact_tokenize,
+         compact.text->length},
+        {"compact", "StringGetView/64k-token-scan", BenchStringTokenScan, &string_scan, compact.text->length},
+        {"compact", "CompactStringGetView/64k-token-scan", BenchCompactStringTokenScan, &compact_scan,
+         compact.text->length},
+        {"compact", "StringCompare/64k-adjacent-tokens", BenchStringTokenCompare, &string_compare, 0},
+        {"compact", "CompactStringCompare/64k-adjacent-tokens", BenchCompactStringTokenCompare, &compact_compare, 0},
+        {"utf8", "Utf8IsValid/64k/ascii", BenchUtf8IsValidAscii, &utf8, utf8.ascii.length},
+        {"utf8", "Utf8IsValid/64k/mixed", BenchUtf8IsValidMixed, &utf8, utf8.mixed.length},
+        {"utf8", "Utf8CountCodePoints/64k/mixed", BenchUtf8CountCodePoints, &utf8, utf8.mixed.length},
+        {"utf8", "StringCaseFold/4k/mixed", BenchStringCaseFold, &utf8, utf8.fold.length},
+        {"utf8", "baseline/StringToLower/4k/mixed", BenchStringToLower, &utf8, utf8.fold.length},
+        {"sort", "StringViewSort/100k/serial", BenchStringViewSort, &sort_serial, sort_serial.bytes},
+        {"sort", "StringViewSort/100k/parallel", BenchStringViewSort, &sort_parallel, sort_parallel.bytes},
+        {"sort", "StringSort/100k/serial", BenchStringSort, &sort_serial, sort_serial.bytes},
+        {"sort", "baseline/qsort/100k", BenchQsortViews, &sort_serial, sort_serial.bytes},
+        {"stack", "StackPush+StackPop", BenchStackPushPop, stack, 0},
+        {"vector", "SizeVectorPush/4096/arena", BenchVectorPush, vector_arena, VECTOR_BENCH_LENGTH * sizeof(size_t)},
+        {"vector", "SizeVectorPush/4096/heap", BenchVectorPush, NULL, VECTOR_BENCH_LENGTH * sizeof(size_t)},
+        {"vector", "StringVectorPush/4096/arena", BenchStringVectorPush, vector_arena,
+         VECTOR_BENCH_LENGTH * sizeof(String *)},
+        {"gc", "CollectorAllocate/stop-the-world", BenchCollectorAllocate, &gc_stop_the_world, 0},
+        {"gc", "CollectorAllocate/incremental-50us", BenchCollectorAllocate, &gc_incremental, 0},
+        {"gc", "CollectorAllocate/small-large-switch", BenchCollectorSwitch, &gc_switch, COLLECTOR_SWITCH_LIVE},
+        {"log", "baseline/printf/line-buffered", BenchLogPrintf, &log_line_buffered, log_line_length},
+        {"log", "baseline/printf/fully-buffered", BenchLogPrintf, &log_fully_buffered, log_line_length},
+        {"log", "Log/ConsoleSink", BenchLogSink, &log_console, log_line_length},
+        {"log", "Log/FileSink", BenchLogSink, &log_file, log_line_length},
+    };
+
+    int exit_status = 0;
+    BenchPrintHeader(stdout, format);
+    for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++) {
+        const BenchCase *bench_case = &cases[i];
+        if (filter != NULL && strstr(bench_case->name, filter) == NULL && strstr(bench_case->group, filter) == NULL) {
+            continue;
+        }
+
+        //Sink cases switch to their sink once, outside the timed repetitions
+        const LogContext *log = strcmp(bench_case->group, "log") == 0 ? bench_case->context : NULL;
+        if (log != NULL && log->sink != NULL) {
+            LogSetSink(log->sink);
+        }
+
+        BenchResult result;
+        const int failed = BenchRun(&result, bench_case->group, bench_case->name, bench_case->function,
+                                    bench_case->context, bench_case->bytes_per_op, &config);
+
+        //Count the writes before switching back: the switch flushes the sink, while the stdio baselines are never flushed
+        double log_writes = -1;
+        if (log != NULL) {
+            log_writes = LogContextWrites(log, log_file.sink);
+            LogSetSink(&null_sink);
+        }
+        if (failed) {
+            fprintf(stderr, "Benchmark %s failed\n", bench_case->name);
+            continue;
+        }
+
+        //Collector cases report their longest pause
+        if (strcmp(bench_case->group, "gc") == 0 && bench_case->context != NULL) {
+            const CollectorContext *gc = bench_case->context;
+            CollectorStats stats;
+            CollectorGetStats(gc->collector, &stats);
+            result.counter_name = "max_pause_us";
+            result.counter = (double) stats.max_pause_ns / 1000.0;
+            //A failed allocation is a bug, not a slow result
+            if (gc->failed_allocations > 0) {
+                fprintf(stderr, "Benchmark %s: %zu allocations failed\n", bench_case->name, gc->failed_allocations);
+                exit_status = 1;
+            }
+        }
+
+        //Compact string cases report the counters measured with the fixtures
+        if (strcmp(bench_case->group, "compact") == 0) {
+            const CompactCase *compact_case = bench_case->context;
+            result.counter_name = compact_case->counter_name;
+            result.counter = compact_case->counter;
+            result.second_counter_name = compact_case->second_counter_name;
+            result.second_counter = compact_case->second_counter;
+        }
+
+        //Log cases report the write calls per one million lines
+        if (log != NULL && log->lines > 0 && log_writes >= 0) {
+            result.counter_name = "writes_per_1m_lines";
+            result.counter = log_writes / (double) log->lines * 1e6;
+        }
+
+        BenchPrintResult(stdout, &result, format);
+        fflush(stdout);
+    }
+
+    //Cleanup
+    LogSinkClose(log_file.sink);
+    LogSinkClose(log_console.sink);
+    if (log_line_buffered.stream != NULL) {
+        fclose(log_line_buffered.stream);
+    }
+    if (log_fully_buffered.stream != NULL) {
+        fclose(log_fully_buffered.stream);
+    }
+    if (log_console.stream != NULL) {
+        fclose(log_console.stream);
+    }
+    //The stack only holds fake pointers, so it is freed by hand instead of StackDelete
+    free(stack->elements);
+    free(stack);
+    free(string.scratch);
+    free(utf8.ascii.c_str);
+    free(utf8.mixed.c_str);
+    free(utf8.fold.c_str);
+    DestroyArena(utf8.arena);
+    DestroyArena(compact.arena);
+    DestroyArena(compact.fixture_arena);
+    SortContextFree(&sort_serial);
+    free(memory.source);
+    free(memory.destination);
+    CollectorDestroy(gc_stop_the_world.collector);
+    CollectorDestroy(gc_incremental.collector);
+    CollectorDestroy(gc_switch.collector);
+    DestroyArena(vector_arena);
+    DestroyArena(string_arena);
+    DestroyArena(arena);
+    LogSetSink(NULL);
+
+    return exit_status;
+}
@@ -0,0 +1,681 @@
+/**
+ * @file    Collector.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Precise mark-sweep garbage collector implementation
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Collector.h"
+#include "../arena/Arena.h"
+#include "../log/Log.h"
+#include "../vector/Vector.h"
+
+//Sizes of the slots of the small object regions
+static const size_t size_classes[COLLECTOR_SIZE_CLASS_COUNT] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048,
+    //Above 4096 the classes are the largest multiples of 16 which fit 12, 10, 8, 6, 5, 4, 3 and 2 times into a page
+    3072, 4096, 5456, 6544, 8192, 10912, 13104, 16384, 21840, 32768
+};
+
+//Every slot is aligned to this, so objects can hold any basic type
+#define COLLECTOR_ALIGNMENT 16
+//Maximum number of slots of a small object region (the smallest size class)
+#define COLLECTOR_MAX_SLOTS (COLLECTOR_REGION_SIZE / 16)
+//Returned by FindFreePages when no run of free pages is long enough
+#define COLLECTOR_NO_PAGE ((size_t) -1)
+//How many grey objects are traced between two checks of the clock
+#define COLLECTOR_MARK_BATCH 64
+
+typedef enum collector_phase {
+    COLLECTOR_IDLE,
+    COLLECTOR_MARKING,
+    COLLECTOR_SWEEPING
+}CollectorPhase;
+
+/**
+ * @brief                   A size class region (one page) or a large object region (a run of pages). Every page
+ *                          has a descriptor with side tables sized for a small region, the descriptor of a page
+ *                          is used while a region starts at that page.
+ */
+typedef struct CollectorRegion {
+    char *data;                     //Start of the object memory
+    size_t bytes;                   //Size of the object memory, a multiple of COLLECTOR_REGION_SIZE
+    size_t first_page, page_count;
+    size_t slot_size, slot_count;
+    int size_class;                 //Index of the size class, -1 for a large object region
+    size_t next_unused;             //Slots from this index on were never handed out
+    size_t live_count;              //Allocated slots
+    void *free_list;                //Reclaimed slots, linked through their first word
+    uint64_t *alloc_bits;           //Side bitmap of allocated slots
+    uint64_t *mark_bits;            //Side bitmap of reached slots
+    unsigned char *types;           //Type index of every slot
+    struct CollectorRegion *previous, *next;    //Links of the size class' available list
+    int in_use, in_available;
+}CollectorRegion;
+
+VECTOR_DECLARE(CollectorRootVector, void **)
+VECTOR_DEFINE(CollectorRootVector, void **)
+VECTOR_DECLARE(CollectorGreyVector, void *)
+VECTOR_DEFINE(CollectorGreyVector, void *)
+
+struct Collector {
+    Arena *arena;
+    CollectorOptions options;
+    char *pages;                                                //The heap, page_count pages of COLLECTOR_REGION_SIZE
+    size_t page_count;
+    CollectorRegion *descriptors;                               //Descriptor of the region starting at every page
+    CollectorRegion **page_owner;                               //Region covering every page, NULL for a free page
+    size_t free_page_hint;                                      //No page below this one is free
+    CollectorRegion *available[COLLECTOR_SIZE_CLASS_COUNT];     //Regions of a size class which have free slots
+    CollectorTraceFunction types[COLLECTOR_MAX_TYPES];
+    int type_count;
+    CollectorRootVector roots;
+    CollectorGreyVector grey;                                   //Marked objects whose fields are not traced yet
+    int grey_overflow;                                          //A marked object could not be pushed to grey
+    size_t retrace_cursor;                                      //Next page to retrace, page_count if not retracing
+    CollectorPhase phase;
+    size_t sweep_cursor;
+    size_t allocated_since_cycle, allocated_since_step;
+    size_t next_threshold;
+    int collecting;
+    unsigned char class_of[COLLECTOR_MAX_SMALL_SIZE / 16 + 1];  //Size class of every 16 byte multiple
+    CollectorStats stats;
+};
+
+static long long GetMonotonicNanoseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (long long) ((double) counter.QuadPart * 1e9 / (double) frequency.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+//Index of the lowest set bit of a non-zero word
+static size_t LowestSetBit(const uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t) __builtin_ctzll(word);
+#else
+    size_t index = 0;
+    while (!(word & ((uint64_t) 1 << index))) {
+        index++;
+    }
+    return index;
+#endif
+}
+
+// ===== Regions =====
+
+//Finds the region covering the given address
+static CollectorRegion *FindRegion(const Collector *collector, const void *pointer) {
+    const uintptr_t address = (uintptr_t) pointer;
+    const uintptr_t base = (uintptr_t) collector->pages;
+    if (address < base || address - base >= collector->page_count * COLLECTOR_REGION_SIZE) {
+        return NULL;
+    }
+    return collector->page_owner[(address - base) / COLLECTOR_REGION_SIZE];
+}
+
+//First fit search for a run of free pages
+static size_t FindFreePages(const Collector *collector, const size_t count) {
+    size_t start = collector->free_page_hint;
+    for (size_t page = collector->free_page_hint; page < collector->page_count; page++) {
+        if (collector->page_owner[page] != NULL) {
+            start = page + 1;
+        }
+        else if (page + 1 - start == count) {
+            return start;
+        }
+    }
+    return COLLECTOR_NO_PAGE;
+}
+
+//Takes a run of free pages from the pool and prepares the region starting at it to hand out slots of the
+//given size. Returns NULL if no run is long enough.
+static CollectorRegion *AcquireRegion(Collector *collector, const size_t page_count, const int size_class,
+                                      const size_t slot_size) {
+    const size_t first_page = FindFreePages(collector, page_count);
+    if (first_page == COLLECTOR_NO_PAGE) {
+        return NULL;
+    }
+
+    CollectorRegion *region = &collector->descriptors[first_page];
+    for (size_t page = first_page; page < first_page + page_count; page++) {
+        collector->page_owner[page] = region;
+    }
+    while (collector->free_page_hint < collector->page_count &&
+           collector->page_owner[collector->free_page_hint] != NULL) {
+        collector->free_page_hint++;
+    }
+
+    region->data = collector->pages + first_page * COLLECTOR_REGION_SIZE;
+    region->bytes = page_count * COLLECTOR_REGION_SIZE;
+    region->first_page = first_page;
+    region->page_count = page_count;
+    region->size_class = size_class;
+    region->slot_size = slot_size;
+    region->slot_count = size_class >= 0 ? region->bytes / slot_size : 1;
+    region->next_unused = 0;
+    region->live_count = 0;
+    region->free_list = NULL;
+    region->previous = NULL;
+    region->next = NULL;
+    region->in_use = 1;
+    region->in_available = 0;
+
+    const size_t words = (region->slot_count + 63) / 64;
+    memset(region->alloc_bits, 0, words * sizeof(uint64_t));
+    memset(region->mark_bits, 0, words * sizeof(uint64_t));
+
+    collector->stats.heap_bytes += region->bytes;
+    return region;
+}
+
+static void AddAvailable(Collector *collector, CollectorRegion *region) {
+    CollectorRegion **head = &collector->available[region->size_class];
+    region->previous = NULL;
+    region->next = *head;
+    if (*head != NULL) {
+        (*head)->previous = region;
+    }
+    *head = region;
+    region->in_available = 1;
+}
+
+static void RemoveAvailable(Collector *collector, CollectorRegion *region) {
+    if (region->previous != NULL) {
+        region->previous->next = region->next;
+    }
+    else {
+        collector->available[region->size_class] = region->next;
+    }
+    if (region->next != NULL) {
+        region->next->previous = region->previous;
+    }
+    region->previous = NULL;
+    region->next = NULL;
+    region->in_available = 0;
+}
+
+//Returns the pages of a region without objects to the pool, where they merge with their free neighbours and
+//serve small and large objects alike
+static void ReleaseRegion(Collector *collector, CollectorRegion *region) {
+    if (region->in_available) {
+        RemoveAvailable(collector, region);
+    }
+    region->in_use = 0;
+    collector->stats.heap_bytes -= region->bytes;
+    for (size_t page = region->first_page; page < region->first_page + region->page_count; page++) {
+        collector->page_owner[page] = NULL;
+    }
+    if (region->first_page < collector->free_page_hint) {
+        collector->free_page_hint = region->first_page;
+    }
+}
+
+static CollectorRegion *AcquireSmallRegion(Collector *collector, const int size_class) {
+    CollectorRegion *region = AcquireRegion(collector, 1, size_class, size_classes[size_class]);
+    if (region == NULL) {
+        return NULL;
+    }
+    AddAvailable(collector, region);
+    return region;
+}
+
+static CollectorRegion *AcquireLargeRegion(Collector *collector, const size_t size) {
+    return AcquireRegion(collector, (size + COLLECTOR_REGION_SIZE - 1) / COLLECTOR_REGION_SIZE, -1, size);
+}
+// ===== Regions =====
+
+// ===== Marking =====
+static void MarkRoots(Collector *collector) {
+    for (size_t i = 0; i < collector->roots.length; i++) {
+        CollectorMark(collector, *collector->roots.data[i]);
+    }
+}
+
+static void TraceObject(Collector *collector, void *object) {
+    const CollectorRegion *region = FindRegion(collector, object);
+    const size_t index = (size_t) ((char *) object - region->data) / region->slot_size;
+    const CollectorTraceFunction trace = collector->types[region->types[index]];
+    if (trace != NULL) {
+        trace(collector, object);
+    }
+}
+
+//Recovers from a failed grey push by tracing every marked object again. The retrace walks one page per call
+//like the sweep, so that an incremental step can stop between pages.
+static void RetraceNextPage(Collector *collector) {
+    const CollectorRegion *region = &collector->descriptors[collector->retrace_cursor++];
+    if (!region->in_use) {
+        return;
+    }
+    for (size_t index = 0; index < region->slot_count; index++) {
+        if (region->mark_bits[index / 64] & ((uint64_t) 1 << (index % 64))) {
+            TraceObject(collector, region->data + index * region->slot_size);
+        }
+    }
+}
+
+void CollectorMark(Collector *collector, const void *pointer) {
+    if (pointer == NULL) {
+        return;
+    }
+    CollectorRegion *region = FindRegion(collector, pointer);
+    if (region == NULL || !region->in_use) {
+        return;
+    }
+
+    const size_t index = (size_t) ((const char *) pointer - region->data) / region->slot_size;
+    if (index >= region->slot_count) {
+        return;
+    }
+    const uint64_t bit = (uint64_t) 1 << (index % 64);
+    if (!(region->alloc_bits[index / 64] & bit) || (region->mark_bits[index / 64] & bit)) {
+        return;
+    }
+    region->mark_bits[index / 64] |= bit;
+
+    //Objects without pointers are done as soon as they are marked
+    if (collector->types[region->types[index]] == NULL) {
+        return;
+    }
+    if (CollectorGreyVectorPush(&collector->grey, region->data + index * region->slot_size) != 0) {
+        collector->grey_overflow = 1;
+    }
+}
+
+void CollectorWriteBarrier(Collector *collector, void **field, void *value) {
+    //Insertion barrier: an object stored while marking is shaded so a traced object never hides it
+    if (collector->phase == COLLECTOR_MARKING) {
+        CollectorMark(collector, value);
+    }
+    *field = value;
+}
+
+static void StartCycle(Collector *collector) {
+    //Marks are cleared in bulk, which is cheap as they live in the side bitmaps
+    for (size_t page = 0; page < collector->page_count; page++) {
+        const CollectorRegion *region = &collector->descriptors[page];
+        if (region->in_use) {
+            memset(region->mark_bits, 0, (region->slot_count + 63) / 64 * sizeof(uint64_t));
+        }
+    }
+    collector->grey.length = 0;
+    collector->grey_overflow = 0;
+    collector->retrace_cursor = collector->page_count;
+    collector->sweep_cursor = 0;
+    collector->allocated_since_cycle = 0;
+    collector->phase = COLLECTOR_MARKING;
+    MarkRoots(collector);
+}
+// ===== Marking =====
+
+// ===== Sweeping =====
+static void SweepRegion(Collector *collector, CollectorRegion *region) {
+    if (!region->in_use) {
+        return;
+    }
+
+    size_t freed = 0;
+    const size_t words = (region->slot_count + 63) / 64;
+    for (size_t w = 0; w < words; w++) {
+        uint64_t dead = region->alloc_bits[w] & ~region->mark_bits[w];
+        if (dead == 0) {
+            continue;
+        }
+        region->alloc_bits[w] &= region->mark_bits[w];
+        while (dead != 0) {
+            const size_t index = w * 64 + LowestSetBit(dead);
+            dead &= dead - 1;
+            void **slot = (void **) (region->data + index * region->slot_size);
+            *slot = region->free_list;
+            region->free_list = slot;
+            freed++;
+        }
+    }
+    if (freed == 0) {
+        return;
+    }
+
+    region->live_count -= freed;
+    collector->stats.live_bytes -= freed * region->slot_size;
+    collector->stats.freed_bytes += freed * region->slot_size;
+
+    if (region->live_count == 0) {
+        ReleaseRegion(collector, region);
+    }
+    else if (region->size_class >= 0 && !region->in_available) {
+        AddAvailable(collector, region);
+    }
+}
+
+static void FinishCycle(Collector *collector) {
+    collector->phase = COLLECTOR_IDLE;
+    collector->stats.collections++;
+
+    //The next cycle starts once as many bytes as are live were allocated, but not before the threshold
+    collector->next_threshold = collector->stats.live_bytes > collector->options.collect_threshold
+                                        ? collector->stats.live_bytes
+                                        : collector->options.collect_threshold;
+}
+// ===== Sweeping =====
+
+//Does collection work until the cycle is finished or the deadline (negative for none) passed.
+//Returns 1 if the cycle finished.
+static int RunCycle(Collector *collector, const long long deadline) {
+    if (collector->phase == COLLECTOR_IDLE) {
+        StartCycle(collector);
+    }
+
+    while (collector->phase == COLLECTOR_MARKING) {
+        void *object;
+        for (size_t i = 0; i < COLLECTOR_MARK_BATCH && CollectorGreyVectorPop(&collector->grey, &object) == 0; i++) {
+            TraceObject(collector, object);
+        }
+        if (collector->grey.length == 0) {
+            //An overflow during a retrace is covered by starting another one once this one is done
+            if (collector->retrace_cursor < collector->page_count) {
+                RetraceNextPage(collector);
+            }
+            else if (collector->grey_overflow) {
+                collector->grey_overflow = 0;
+                collector->retrace_cursor = 0;
+            }
+            else {
+                //The roots are not covered by the write barrier, so they are scanned again before marking ends
+                MarkRoots(collector);
+                if (collector->grey.length == 0 && !collector->grey_overflow) {
+                    collector->phase = COLLECTOR_SWEEPING;
+                }
+            }
+        }
+        if (deadline >= 0 && GetMonotonicNanoseconds() >= deadline) {
+            return 0;
+        }
+    }
+
+    while (collector->phase == COLLECTOR_SWEEPING) {
+        if (collector->sweep_cursor >= collector->page_count) {
+            FinishCycle(collector);
+            return 1;
+        }
+        //The cursor walks the pages, a region is swept at its first page
+        SweepRegion(collector, &collector->descriptors[collector->sweep_cursor++]);
+        if (deadline >= 0 && GetMonotonicNanoseconds() >= deadline) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void RecordPause(Collector *collector, const long long start) {
+    const long long pause = GetMonotonicNanoseconds() - start;
+    collector->stats.steps++;
+    collector->stats.last_pause_ns = pause;
+    collector->stats.total_pause_ns += pause;
+    if (pause > collector->stats.max_pause_ns) {
+        collector->stats.max_pause_ns = pause;
+    }
+}
+
+int CollectorStep(Collector *collector) {
+    collector->collecting = 1;
+    const long long start = GetMonotonicNanoseconds();
+    const long long deadline = collector->options.step_budget_ns > 0 ? start + collector->options.step_budget_ns : -1;
+    const int finished = RunCycle(collector, deadline);
+    collector->allocated_since_step = 0;
+    RecordPause(collector, start);
+    collector->collecting = 0;
+    return finished;
+}
+
+void CollectorCollect(Collector *collector) {
+    collector->collecting = 1;
+    const long long start = GetMonotonicNanoseconds();
+    //A running cycle has allocated objects black, so a fresh cycle follows it to reclaim everything
+    if (collector->phase != COLLECTOR_IDLE) {
+        RunCycle(collector, -1);
+    }
+    RunCycle(collector, -1);
+    collector->allocated_since_step = 0;
+    RecordPause(collector, start);
+    collector->collecting = 0;
+}
+
+//Runs the collection work an allocation owes before it is served
+static void CollectIfNeeded(Collector *collector) {
+    if (collector->collecting) {
+        return;
+    }
+    if (collector->options.step_budget_ns > 0) {
+        //A running cycle advances by one step every 1/16 of the threshold allocated
+        if (collector->phase != COLLECTOR_IDLE) {
+            if (collector->allocated_since_step >= collector->options.collect_threshold / 16) {
+                CollectorStep(collector);
+            }
+        }
+        else if (collector->allocated_since_cycle >= collector->next_threshold) {
+            CollectorStep(collector);
+        }
+    }
+    else if (collector->allocated_since_cycle >= collector->next_threshold) {
+        CollectorCollect(collector);
+    }
+}
+
+static void *AllocateSlot(Collector *collector, const size_t size, const int type) {
+    CollectorRegion *region;
+    size_t index;
+
+    if (size <= COLLECTOR_MAX_SMALL_SIZE) {
+        const int size_class = collector->class_of[(size + 15) / 16];
+        region = collector->available[size_class];
+        if (region == NULL) {
+            region = AcquireSmallRegion(collector, size_class);
+            if (region == NULL) {
+                return NULL;
+            }
+        }
+
+        //Reuse a reclaimed slot before touching fresh memory
+        if (region->free_list != NULL) {
+            void **slot = region->free_list;
+            region->free_list = *slot;
+            index = (size_t) ((char *) slot - region->data) / region->slot_size;
+        }
+        else {
+            index = region->next_unused++;
+        }
+        if (region->free_list == NULL && region->next_unused == region->slot_count) {
+            RemoveAvailable(collector, region);
+        }
+    }
+    else {
+        region = AcquireLargeRegion(collector, BIT_ALIGNMENT_64(size));
+        if (region == NULL) {
+            return NULL;
+        }
+        index = 0;
+    }
+
+    const uint64_t bit = (uint64_t) 1 << (index % 64);
+    region->alloc_bits[index / 64] |= bit;
+    //Objects allocated during a cycle are black, the next cycle clears the marks before it starts
+    if (collector->phase != COLLECTOR_IDLE) {
+        region->mark_bits[index / 64] |= bit;
+    }
+    region->types[index] = (unsigned char) type;
+    region->live_count++;
+
+    void *object = region->data + index * region->slot_size;
+    memset(object, 0, region->slot_size);
+
+    collector->stats.live_bytes += region->slot_size;
+    collector->stats.allocated_bytes += region->slot_size;
+    collector->allocated_since_cycle += region->slot_size;
+    collector->allocated_since_step += region->slot_size;
+    return object;
+}
+
+void *CollectorAllocate(Collector *collector, const size_t size, const int type) {
+    if (type < 0 || type >= collector->type_count || size > collector->page_count * COLLECTOR_REGION_SIZE) {
+        return NULL;
+    }
+
+    CollectIfNeeded(collector);
+
+    void *object = AllocateSlot(collector, size == 0 ? 1 : size, type);
+    if (object == NULL && !collector->collecting) {
+        //The heap is full, reclaim what can be reclaimed and retry once
+        CollectorCollect(collector);
+        object = AllocateSlot(collector, size == 0 ? 1 : size, type);
+    }
+    if (object == NULL) {
+        char message_buffer[100];
+        snprintf(message_buffer, sizeof message_buffer,
+                 "Collector at %p cannot allocate %zu bytes, heap exhausted\n", (void *) collector, size);
+        Log(ERROR, message_buffer);
+    }
+    return object;
+}
+
+int CollectorRegisterType(Collector *collector, const CollectorTraceFunction trace) {
+    if (collector->type_count >= COLLECTOR_MAX_TYPES) {
+        return -1;
+    }
+    collector->types[collector->type_count] = trace;
+    return collector->type_count++;
+}
+
+int CollectorAddRoot(Collector *collector, void **root) {
+    return CollectorRootVectorPush(&collector->roots, root);
+}
+
+void CollectorRemoveRoot(Collector *collector, void **root) {
+    for (size_t i = 0; i < collector->roots.length; i++) {
+        if (collector->roots.data[i] == root) {
+            CollectorRootVectorSwapRemove(&collector->roots, i, NULL);
+            return;
+        }
+    }
+}
+
+void CollectorGetStats(const Collector *collector, CollectorStats *stats) {
+    *stats = collector->stats;
+}
+
+//Divides the arena into pages plus the descriptor, side tables and owner entry of every page
+static int CreatePages(Collector *collector) {
+    Arena *arena = collector->arena;
+    const size_t words = COLLECTOR_MAX_SLOTS / 64;
+    const size_t page_cost = sizeof(CollectorRegion) + sizeof(CollectorRegion *) + 2 * words * sizeof(uint64_t) +
+                             COLLECTOR_MAX_SLOTS + COLLECTOR_REGION_SIZE;
+    //Leave room for the padding of the five blocks and the alignment of the pages
+    const size_t slack = 5 * 8 + COLLECTOR_ALIGNMENT;
+    if (arena->size <= slack) {
+        return 1;
+    }
+    const size_t page_count = (arena->size - slack) / page_cost;
+    if (page_count == 0) {
+        char message_buffer[100];
+        snprintf(message_buffer, sizeof message_buffer,
+                 "Collector heap of %zu bytes is smaller than a single page\n", arena->size);
+        Log(ERROR, message_buffer);
+        return 1;
+    }
+
+    CollectorRegion *descriptors = ArenaAllocate(arena, page_count * sizeof(CollectorRegion));
+    CollectorRegion **page_owner = ArenaAllocate(arena, page_count * sizeof(CollectorRegion *));
+    uint64_t *bitmaps = ArenaAllocate(arena, page_count * 2 * words * sizeof(uint64_t));
+    unsigned char *types = ArenaAllocate(arena, page_count * COLLECTOR_MAX_SLOTS);
+    char *raw_pages = ArenaAllocate(arena, page_count * COLLECTOR_REGION_SIZE + COLLECTOR_ALIGNMENT);
+    if (descriptors == NULL || page_owner == NULL || bitmaps == NULL || types == NULL || raw_pages == NULL) {
+        return 1;
+    }
+
+    memset(descriptors, 0, page_count * sizeof(CollectorRegion));
+    memset(page_owner, 0, page_count * sizeof(CollectorRegion *));
+    for (size_t page = 0; page < page_count; page++) {
+        descriptors[page].alloc_bits = bitmaps + page * 2 * words;
+        descriptors[page].mark_bits = bitmaps + page * 2 * words + words;
+        descriptors[page].types = types + page * COLLECTOR_MAX_SLOTS;
+    }
+
+    collector->pages = (char *) (((uintptr_t) raw_pages + COLLECTOR_ALIGNMENT - 1) &
+                                 ~(uintptr_t) (COLLECTOR_ALIGNMENT - 1));
+    collector->page_count = page_count;
+    collector->descriptors = descriptors;
+    collector->page_owner = page_owner;
+    collector->free_page_hint = 0;
+    collector->stats.region_count = page_count;
+    return 0;
+}
+
+Collector *CollectorCreate(const CollectorOptions *options) {
+    //Heap allocate the collector object, zeroed so that every list starts empty
+    Collector *collector = calloc(1, sizeof(Collector));
+    if (collector == NULL) {
+        return NULL;
+    }
+
+    //Apply the options, falling back to the defaults for zero values
+    const CollectorOptions defaults = {0};
+    if (options == NULL) {
+        options = &defaults;
+    }
+    collector->options = *options;
+    if (collector->options.heap_size == 0) {
+        collector->options.heap_size = 64 * COLLECTOR_REGION_SIZE;
+    }
+    if (collector->options.collect_threshold == 0) {
+        collector->options.collect_threshold = COLLECTOR_DEFAULT_THRESHOLD;
+    }
+    collector->next_threshold = collector->options.collect_threshold;
+
+    collector->arena = CreateArena(collector->options.heap_size);
+    if (collector->arena == NULL || collector->arena->base == NULL) {
+        free(collector);
+        return NULL;
+    }
+    if (CreatePages(collector) != 0) {
+        DestroyArena(collector->arena);
+        free(collector);
+        return NULL;
+    }
+
+    CollectorRootVectorInit(&collector->roots, NULL, 0);
+    CollectorGreyVectorInit(&collector->grey, NULL, 0);
+
+    //Type 0 is the built-in leaf type
+    collector->types[COLLECTOR_TYPE_LEAF] = NULL;
+    collector->type_count = 1;
+
+    //Map every 16 byte multiple to the smallest size class which fits it
+    int size_class = 0;
+    for (size_t i = 0; i <= COLLECTOR_MAX_SMALL_SIZE / 16; i++) {
+        while (size_classes[size_class] < i * 16) {
+            size_class++;
+        }
+        collector->class_of[i] = (unsigned char) size_class;
+    }
+
+    return collector;
+}
+
+void CollectorDestroy(Collector *collector) {
+    CollectorRootVectorFree(&collector->roots);
+    CollectorGreyVectorFree(&collector->grey);
+    DestroyArena(collector->arena);
+    free(collector);
+}
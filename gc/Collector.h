@@ -0,0 +1,160 @@
+/**
+ * @file    Collector.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Optional precise mark-sweep garbage collector built on arena blocks
+ *
+ * The collector divides its own arena into pages of COLLECTOR_REGION_SIZE bytes. A region holding objects of one
+ * size class takes one page, a large object takes a region of adjacent pages. Pages of empty regions go back to a
+ * single pool, so memory freed by one kind of object serves the other. Regions keep the allocation and mark bits
+ * in side bitmaps, so objects carry no header. Objects are traced precisely:
+ * the caller registers the addresses of its root pointers and an object type with a trace function for every
+ * object layout which contains pointers. Dead objects are swept into per region free lists of their size class.
+ *
+ * Collections run either stop-the-world or incrementally, in steps bounded by a time budget. While an incremental
+ * cycle is running, pointer stores into collected objects must go through CollectorWriteBarrier.
+ *
+ * Any allocation may start a collection, so every pointer to a collected object which is still needed must be
+ * reachable from a registered root (or from an object reachable from one) when CollectorAllocate is called.
+ */
+
+#ifndef COLLECTOR_H
+#define COLLECTOR_H
+
+#include <stddef.h>
+
+/**
+ * @defgroup COLLECTOR_CONSTANTS
+ * @{
+ * @brief Layout constants of the collector
+ */
+#define COLLECTOR_REGION_SIZE           (64 * 1024)     //Size of a page, a region holding small objects is one page
+#define COLLECTOR_MAX_SMALL_SIZE        32768           //Larger objects get a region of their own
+#define COLLECTOR_SIZE_CLASS_COUNT      24
+#define COLLECTOR_MAX_TYPES             256
+#define COLLECTOR_TYPE_LEAF             0               //Built-in type for objects without pointers
+#define COLLECTOR_DEFAULT_THRESHOLD     (1024 * 1024)   //Bytes allocated before the first collection
+/**
+ * @}
+ */
+
+typedef struct Collector Collector;
+
+/**
+ * @brief                   Trace function of an object type. It calls CollectorMark for every pointer field
+ *                          of the object.
+ * @param collector         The collector which is tracing
+ * @param object            The object to trace
+ */
+typedef void (*CollectorTraceFunction)(Collector *collector, void *object);
+
+/**
+ * @brief                   Options for the collector. Zero valued fields fall back to their defaults.
+ */
+typedef struct CollectorOptions {
+    size_t heap_size;               //Size of the collector's arena (pages and their side tables), the heap cannot grow past it
+    size_t collect_threshold;       //Minimum bytes allocated between two collections
+    long long step_budget_ns;       //Pause budget of an incremental step, 0 for stop-the-world collections
+}CollectorOptions;
+
+/**
+ * @brief                   Counters of the collector. Pauses are the durations of the collection work done
+ *                          inside CollectorAllocate, CollectorStep and CollectorCollect.
+ */
+typedef struct CollectorStats {
+    size_t collections;             //Completed collection cycles
+    size_t steps;                   //Pauses (a stop-the-world collection is a single pause)
+    long long last_pause_ns;
+    long long max_pause_ns;
+    long long total_pause_ns;
+    size_t live_bytes;              //Bytes in allocated objects
+    size_t heap_bytes;              //Bytes in regions which are in use
+    size_t region_count;            //Pages the heap is divided into
+    size_t allocated_bytes;         //Total bytes handed out
+    size_t freed_bytes;             //Total bytes reclaimed by sweeping
+}CollectorStats;
+
+/**
+ * @brief                   Creates a collector with its own arena.
+ * @param options           Collector options, NULL for the defaults
+ * @return                  Heap allocated collector or NULL on failure (e.g. a heap smaller than one page)
+ */
+Collector *CollectorCreate(const CollectorOptions *options);
+
+/**
+ * @brief                   Frees the collector, its arena and every object in it.
+ * @param collector         Collector to be destroyed
+ */
+void CollectorDestroy(Collector *collector);
+
+/**
+ * @brief                   Registers an object type.
+ * @param collector         The collector
+ * @param trace             Trace function of the type, NULL for objects without pointers
+ * @return                  The type index or -1 if the type table is full
+ */
+int CollectorRegisterType(Collector *collector, CollectorTraceFunction trace);
+
+/**
+ * @brief                   Allocates a zero initialised object. May run collection work first.
+ * @param collector         The collector
+ * @param size              Size of the object
+ * @param type              The type index returned by CollectorRegisterType or COLLECTOR_TYPE_LEAF
+ * @return                  The object or NULL if the heap is exhausted
+ */
+void *CollectorAllocate(Collector *collector, size_t size, int type);
+
+/**
+ * @brief                   Registers the address of a root pointer. The pointer is read at every collection.
+ * @param collector         The collector
+ * @param root              Address of the root pointer
+ * @return                  0 on success, 1 on failure
+ */
+int CollectorAddRoot(Collector *collector, void **root);
+
+/**
+ * @brief                   Unregisters the address of a root pointer.
+ * @param collector         The collector
+ * @param root              Address of the root pointer
+ */
+void CollectorRemoveRoot(Collector *collector, void **root);
+
+/**
+ * @brief                   Marks an object as reachable. Only called from trace functions.
+ *                          Pointers which do not point into a live object are ignored.
+ * @param collector         The collector
+ * @param pointer           Pointer to (or into) an object
+ */
+void CollectorMark(Collector *collector, const void *pointer);
+
+/**
+ * @brief                   Stores a pointer into a field of a collected object, keeping an incremental
+ *                          cycle correct.
+ * @param collector         The collector
+ * @param field             Address of the pointer field
+ * @param value             The pointer to store
+ */
+void CollectorWriteBarrier(Collector *collector, void **field, void *value);
+
+/**
+ * @brief                   Runs one incremental step within the configured budget. Starts a new cycle if none
+ *                          is running. Without a budget (stop-the-world mode) the step runs a whole cycle.
+ * @param collector         The collector
+ * @return                  1 if the step completed a cycle, 0 otherwise
+ */
+int CollectorStep(Collector *collector);
+
+/**
+ * @brief                   Runs a full stop-the-world collection, finishing any running cycle first.
+ * @param collector         The collector
+ */
+void CollectorCollect(Collector *collector);
+
+/**
+ * @brief                   Gets the counters of the collector.
+ * @param collector         The collector
+ * @param stats             Stats to write to
+ */
+void CollectorGetStats(const Collector *collector, CollectorStats *stats);
+
+#endif //COLLECTOR_H
@@ -6,10 +6,12 @@
  */
 
 #include "Log.h"
+#include "LogSink.h"
 #include "../string/String.h"
 
 #include <time.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
 
@@ -48,6 +50,49 @@ void GetTimestamp(char *buffer, size_t buffer_size) {
 }
 
 
+//The default stdout sink, static so that switching sinks back and forth never allocates
+static ConsoleSink default_sink;
+
+//The sink every message is written to, lazily set to the default sink on first use
+static LogSink *active_sink = NULL;
+
+static LogSink *GetActiveSink(void) {
+    if (active_sink == NULL) {
+        ConsoleSinkInit(&default_sink, stdout);
+        active_sink = (LogSink *) &default_sink;
+    }
+    return active_sink;
+}
+
+//Writes out what the active sink still buffers when the process exits normally, as stdio did for printf
+static void FlushAtExit(void) {
+    if (active_sink != NULL) {
+        active_sink->flush(active_sink);
+    }
+}
+
+void LogSetSink(LogSink *sink) {
+    static int exit_flush_registered = 0;
+    if (sink != NULL && !exit_flush_registered) {
+        exit_flush_registered = atexit(FlushAtExit) == 0;
+    }
+
+    //Push out whatever the previous sink still buffers so that no message is lost on the switch
+    if (active_sink != NULL) {
+        active_sink->flush(active_sink);
+    }
+    active_sink = sink;
+}
+
+LogSink *LogGetSink(void) {
+    return GetActiveSink();
+}
+
+void LogFlush(void) {
+    LogSink *sink = GetActiveSink();
+    sink->flush(sink);
+}
+
 void Log(const LogLevel level, const char* message) {
     //The logging decorator
     char *decorator = "";
@@ -58,19 +103,47 @@ void Log(const LogLevel level, const char* message) {
     //Get the timestamp and write to the timestamp buffer
     GetTimestamp(timestamp, sizeof(timestamp));
 
-    //Set the decorator based on the level
+    //Get the sink to write to
+    LogSink *sink = GetActiveSink();
+
+    //Set the decorator based on the level, colour codes are only used if the sink supports them
     switch (level) {
         case INFO:
-            decorator = "\x1b[30;46m[INFO]\x1b[0m";
+            decorator = sink->use_colors ? "\x1b[30;46m[INFO]\x1b[0m" : "[INFO]";
         break;
         case WARNING:
-            decorator = "\x1b[30;43m[WARN]\x1b[0m";
+            decorator = sink->use_colors ? "\x1b[30;43m[WARN]\x1b[0m" : "[WARN]";
         break;
         case ERROR:
-            decorator = "\x1b[30;41m[ERROR]\x1b[0m";
+            decorator = sink->use_colors ? "\x1b[30;41m[ERROR]\x1b[0m" : "[ERROR]";
         break;
     }
 
-    //Print
-    printf("%s %s: %s", timestamp, decorator, message);
-}
\ No newline at end of file
+    //Format the whole line in one buffer and write it with one call so that a sink never splits it
+    //(e.g. across a file rotation)
+    char line[1024];
+    const int line_length = snprintf(line, sizeof line, "%s %s: %s", timestamp, decorator, message);
+    if (line_length < 0) {
+        return;
+    }
+
+    //Write
+    if ((size_t) line_length < sizeof line) {
+        sink->write(sink, line, (size_t) line_length);
+        return;
+    }
+
+    //Long messages are formatted into a heap buffer so they are neither truncated nor split
+    char *long_line = malloc((size_t) line_length + 1);
+    if (long_line != NULL) {
+        snprintf(long_line, (size_t) line_length + 1, "%s %s: %s", timestamp, decorator, message);
+        sink->write(sink, long_line, (size_t) line_length);
+        free(long_line);
+    }
+    //Out of memory, write prefix and message separately rather than dropping the message
+    else {
+        const size_t message_length = strlen(message);
+        sink->write(sink, line, (size_t) line_length - message_length);
+        sink->write(sink, message, message_length);
+    }
+}
@@ -17,6 +17,8 @@
     #error "Unsupported OS"
 #endif
 
+#include "LogSink.h"
+
 typedef enum log_level {
     INFO,
     WARNING,
@@ -37,4 +39,23 @@ void GetTimestamp(char *buffer, size_t buffer_size);
  */
 void Log(LogLevel level, const char* message);
 
+/**
+ * @brief               Sets the sink the logger writes to. The previous sink is flushed but not closed.
+ *                      NULL restores the default console sink which writes to stdout. The active sink is
+ *                      flushed at normal process exit, so a sink must be replaced before it is closed.
+ * @param sink          The sink to write to
+ */
+void LogSetSink(LogSink *sink);
+
+/**
+ * @brief               Gets the sink the logger currently writes to.
+ * @return              The active sink
+ */
+LogSink *LogGetSink(void);
+
+/**
+ * @brief               Flushes the active sink.
+ */
+void LogFlush(void);
+
 #endif
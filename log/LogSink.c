@@ -0,0 +1,264 @@
+/**
+ * @file    LogSink.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Console and rotating buffered file sinks for the logger
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <io.h>
+    #include <windows.h>
+    #define IS_TERMINAL(stream) _isatty(_fileno(stream))
+#else
+    #include <unistd.h>
+    #define IS_TERMINAL(stream) isatty(fileno(stream))
+#endif
+
+#include "LogSink.h"
+#include "Log.h"
+
+//Monotonic clock in milliseconds, only used for the time based flush
+static long long GetMonotonicMilliseconds(void) {
+#ifdef _WIN32
+    return (long long) GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+// ===== Console Sink =====
+static void ConsoleSinkWrite(LogSink *sink, const char *data, const size_t length) {
+    const ConsoleSink *console = (ConsoleSink *) sink;
+    fwrite(data, 1, length, console->stream);
+}
+
+static void ConsoleSinkFlush(LogSink *sink) {
+    const ConsoleSink *console = (ConsoleSink *) sink;
+    fflush(console->stream);
+}
+
+static void ConsoleSinkClose(LogSink *sink) {
+    ConsoleSinkFlush(sink);
+    free(sink);
+}
+
+void ConsoleSinkInit(ConsoleSink *sink, FILE *stream) {
+    sink->base.write = ConsoleSinkWrite;
+    sink->base.flush = ConsoleSinkFlush;
+    //The caller owns the storage, so closing only flushes
+    sink->base.close = ConsoleSinkFlush;
+    //Escape sequences only make sense on a terminal, redirected output gets plain text
+    sink->base.use_colors = IS_TERMINAL(stream) ? 1 : 0;
+    sink->stream = stream;
+}
+
+LogSink *ConsoleSinkCreate(FILE *stream) {
+    //Heap allocate the sink object
+    ConsoleSink *sink = malloc(sizeof(ConsoleSink));
+    if (sink == NULL) {
+        return NULL;
+    }
+
+    ConsoleSinkInit(sink, stream);
+    sink->base.close = ConsoleSinkClose;
+
+    return (LogSink *) sink;
+}
+// ===== Console Sink =====
+
+// ===== File Sink =====
+
+static int FileSinkOpen(FileSink *sink, const char *mode);
+
+//Writes the given bytes straight to the file. The stream is unbuffered, so this is a single write call.
+static void FileSinkWriteOut(FileSink *sink, const char *data, const size_t length) {
+    if (length == 0) {
+        return;
+    }
+    //A failed reopen after a rotation leaves no file, retry it and count the bytes as lost if it fails again
+    if (sink->file == NULL && !FileSinkOpen(sink, "ab")) {
+        sink->write_errors++;
+        return;
+    }
+    const size_t written = fwrite(data, 1, length, sink->file);
+    if (written != length) {
+        sink->write_errors++;
+    }
+    sink->flush_count++;
+    sink->bytes_written += written;
+    sink->file_size += written;
+}
+
+static void FileSinkFlush(LogSink *base) {
+    FileSink *sink = (FileSink *) base;
+    FileSinkWriteOut(sink, sink->buffer, sink->buffer_offset);
+    sink->buffer_offset = 0;
+    sink->last_flush_ms = GetMonotonicMilliseconds();
+}
+
+//Opens the log file in the given mode and disables stdio buffering as the sink does its own buffering
+static int FileSinkOpen(FileSink *sink, const char *mode) {
+    sink->file = fopen(sink->path, mode);
+    if (sink->file == NULL) {
+        //Nothing is written until a reopen succeeds, so the old size must not trigger further rotations
+        sink->file_size = 0;
+        return 0;
+    }
+    setvbuf(sink->file, NULL, _IONBF, 0);
+
+    //Pick up the size of an existing file so that rotation accounts for it
+    fseek(sink->file, 0, SEEK_END);
+    const long position = ftell(sink->file);
+    sink->file_size = position > 0 ? (size_t) position : 0;
+    return 1;
+}
+
+//Shifts "path" -> "path.1" -> "path.2"... dropping the oldest backup, then starts a fresh file
+static void FileSinkRotate(FileSink *sink) {
+    FileSinkFlush((LogSink *) sink);
+    if (sink->file != NULL) {
+        fclose(sink->file);
+        sink->file = NULL;
+    }
+
+    //Room for the path, a dot, the backup index and the null terminator
+    const size_t name_size = strlen(sink->path) + 24;
+    char *older = malloc(name_size);
+    char *newer = malloc(name_size);
+
+    if (older != NULL && newer != NULL) {
+        if (sink->max_backups > 0) {
+            snprintf(older, name_size, "%s.%d", sink->path, sink->max_backups);
+            remove(older);
+            for (int i = sink->max_backups - 1; i >= 1; i--) {
+                snprintf(newer, name_size, "%s.%d", sink->path, i);
+                snprintf(older, name_size, "%s.%d", sink->path, i + 1);
+                rename(newer, older);
+            }
+            snprintf(older, name_size, "%s.1", sink->path);
+            rename(sink->path, older);
+        }
+        else {
+            remove(sink->path);
+        }
+    }
+    free(older);
+    free(newer);
+
+    FileSinkOpen(sink, "wb");
+    sink->rotation_count++;
+}
+
+static void FileSinkWrite(LogSink *base, const char *data, const size_t length) {
+    FileSink *sink = (FileSink *) base;
+
+    //Rotate before the pending bytes plus the new data would push the file past its limit.
+    //An empty file is never rotated so a single oversized write cannot rotate forever.
+    //Without an open file there is nothing to rotate, the next flush retries the open instead.
+    if (sink->max_file_size > 0 && sink->file != NULL &&
+        sink->file_size + sink->buffer_offset > 0 &&
+        sink->file_size + sink->buffer_offset + length > sink->max_file_size) {
+        FileSinkRotate(sink);
+    }
+
+    //Make room in the buffer if the data does not fit
+    if (sink->buffer_offset + length > sink->buffer_size) {
+        FileSinkFlush(base);
+    }
+
+    //Data larger than the whole buffer bypasses it
+    if (length > sink->buffer_size) {
+        FileSinkWriteOut(sink, data, length);
+        return;
+    }
+
+    memcpy(sink->buffer + sink->buffer_offset, data, length);
+    sink->buffer_offset += length;
+
+    //Flush on the size threshold or when the flush interval elapsed
+    if (sink->buffer_offset >= sink->flush_threshold) {
+        FileSinkFlush(base);
+    }
+    else if (sink->flush_interval_ms >= 0 &&
+             GetMonotonicMilliseconds() - sink->last_flush_ms >= sink->flush_interval_ms) {
+        FileSinkFlush(base);
+    }
+}
+
+static void FileSinkClose(LogSink *base) {
+    FileSink *sink = (FileSink *) base;
+    FileSinkFlush(base);
+    if (sink->file != NULL) {
+        fclose(sink->file);
+    }
+    free(sink->buffer);
+    free(sink->path);
+    free(sink);
+}
+
+LogSink *FileSinkCreate(const char *path, const FileSinkOptions *options) {
+    //Heap allocate the sink object, zeroed so that every counter starts at 0
+    FileSink *sink = calloc(1, sizeof(FileSink));
+    if (sink == NULL) {
+        return NULL;
+    }
+
+    sink->base.write = FileSinkWrite;
+    sink->base.flush = FileSinkFlush;
+    sink->base.close = FileSinkClose;
+    sink->base.use_colors = 0;
+
+    //Apply the options, falling back to the defaults for zero values
+    const FileSinkOptions defaults = {0};
+    if (options == NULL) {
+        options = &defaults;
+    }
+    sink->buffer_size = options->buffer_size ? options->buffer_size : FILE_SINK_DEFAULT_BUFFER_SIZE;
+    sink->flush_threshold = options->flush_threshold ? options->flush_threshold : sink->buffer_size;
+    if (sink->flush_threshold > sink->buffer_size) {
+        sink->flush_threshold = sink->buffer_size;
+    }
+    sink->flush_interval_ms = options->flush_interval_ms ? options->flush_interval_ms
+                                                         : FILE_SINK_DEFAULT_FLUSH_INTERVAL_MS;
+    sink->max_file_size = options->max_file_size;
+    sink->max_backups = options->max_backups;
+
+    //Copy the path as it is needed again on rotation
+    const size_t path_length = strlen(path);
+    sink->path = malloc(path_length + 1);
+    sink->buffer = malloc(sink->buffer_size);
+    if (sink->path == NULL || sink->buffer == NULL) {
+        free(sink->path);
+        free(sink->buffer);
+        free(sink);
+        return NULL;
+    }
+    memcpy(sink->path, path, path_length + 1);
+
+    if (!FileSinkOpen(sink, "ab")) {
+        char message_buffer[512];
+        snprintf(message_buffer, sizeof message_buffer, "Cannot open log file %s\n", path);
+        Log(ERROR, message_buffer);
+        free(sink->path);
+        free(sink->buffer);
+        free(sink);
+        return NULL;
+    }
+    sink->last_flush_ms = GetMonotonicMilliseconds();
+
+    return (LogSink *) sink;
+}
+// ===== File Sink =====
+
+void LogSinkClose(LogSink *sink) {
+    if (sink != NULL) {
+        sink->close(sink);
+    }
+}
@@ -0,0 +1,107 @@
+/**
+ * @file    LogSink.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Output sinks for the logger (console and rotating buffered file)
+ */
+
+#ifndef LOG_SINK_H
+#define LOG_SINK_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * @defgroup FILE_SINK_DEFAULTS
+ * @{
+ * @brief Default values used by FileSinkCreate when an option is left as 0
+ */
+#define FILE_SINK_DEFAULT_BUFFER_SIZE       (1024 * 1024)
+#define FILE_SINK_DEFAULT_FLUSH_INTERVAL_MS 1000
+/**
+ * @}
+ */
+
+/**
+ * @brief               Generic sink interface. Every sink embeds this struct as its first member so that a pointer
+ *                      to the concrete sink can be used as a LogSink pointer.
+ */
+typedef struct LogSink {
+    void (*write)(struct LogSink *sink, const char *data, size_t length);  //Writes raw bytes to the sink
+    void (*flush)(struct LogSink *sink);                                    //Pushes buffered bytes to the output
+    void (*close)(struct LogSink *sink);                                    //Flushes and frees the sink
+    int use_colors;     //1 if the logger should emit ANSI colour codes, 0 otherwise
+}LogSink;
+
+/**
+ * @brief               Sink which writes to a stdio stream (stdout, stderr...)
+ */
+typedef struct ConsoleSink {
+    LogSink base;
+    FILE *stream;
+}ConsoleSink;
+
+/**
+ * @brief               Options for the file sink. Zero valued fields fall back to their defaults.
+ */
+typedef struct FileSinkOptions {
+    size_t buffer_size;         //Size of the user-space write buffer
+    size_t flush_threshold;     //Flush once this many bytes are buffered (defaults to buffer_size)
+    long flush_interval_ms;     //Flush if this much time passed since the last flush, negative disables it
+    size_t max_file_size;       //Rotate the file once it would grow past this size, 0 disables rotation
+    int max_backups;            //How many rotated files ("path.1", "path.2"...) to keep
+}FileSinkOptions;
+
+/**
+ * @brief               Sink which buffers messages in memory and writes them to a file in large chunks.
+ *                      The time based flush is checked on every write, there is no background thread.
+ */
+typedef struct FileSink {
+    LogSink base;
+    FILE *file;
+    char *path;
+    char *buffer;
+    size_t buffer_size, buffer_offset;
+    size_t flush_threshold;
+    long flush_interval_ms;
+    long long last_flush_ms;
+    size_t file_size, max_file_size;
+    int max_backups;
+    size_t flush_count;         //Number of write calls issued to the OS
+    size_t rotation_count;      //Number of rotations performed
+    size_t bytes_written;       //Total bytes written to the OS
+    size_t write_errors;        //Number of failed or short writes, including writes dropped without an open file
+}FileSink;
+
+/**
+ * @brief               Initialises a console sink in caller owned storage (e.g. a static). Closing it only
+ *                      flushes the stream. Colours are enabled only if the stream is a terminal.
+ * @param sink          The sink to initialise
+ * @param stream        The stream to write to
+ */
+void ConsoleSinkInit(ConsoleSink *sink, FILE *stream);
+
+/**
+ * @brief               Creates a console sink. Colours are enabled only if the stream is a terminal.
+ * @param stream        The stream to write to
+ * @return              Heap allocated sink or NULL on failure
+ */
+LogSink *ConsoleSinkCreate(FILE *stream);
+
+/**
+ * @brief               Creates a buffered file sink. The file is opened in append mode.
+ *                      Colours are disabled as the output is not a terminal. Buffered lines are written by
+ *                      LogSinkClose, LogFlush, or at normal process exit while the sink is the active one.
+ * @param path          Path of the log file
+ * @param options       Sink options, NULL for the defaults
+ * @return              Heap allocated sink or NULL on failure
+ */
+LogSink *FileSinkCreate(const char *path, const FileSinkOptions *options);
+
+/**
+ * @brief               Flushes and frees a given sink.
+ * @param sink          Sink to be closed
+ */
+void LogSinkClose(LogSink *sink);
+
+#endif //LOG_SINK_H
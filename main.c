@@ -1,7 +1,3 @@
-/*
- * @todo: Implement garbage collector
- */
-
 int main(void) {
     return 0;
 }
@@ -0,0 +1,157 @@
+/**
+ * @file    CompactString.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Compact string implementation
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "CompactString.h"
+
+#define IS_INLINE(length) ((length) <= COMPACT_STRING_INLINE_CAPACITY)
+
+//Stores a short string inline, zero padding the rest of the buffer so that it can be compared as two words
+static void StoreInline(CompactString *str, const char *data, const size_t length) {
+    str->length = length;
+    memset(str->inline_data, 0, sizeof str->inline_data);
+    memcpy(str->inline_data, data, length);
+}
+
+//Creates a string from a character range with a single allocation
+static CompactString *CreateFromRange(Arena *arena, const char *data, const size_t length) {
+    if (IS_INLINE(length)) {
+        CompactString *str = ArenaAllocate(arena, sizeof(CompactString));
+        if (str == NULL) {
+            return NULL;
+        }
+        StoreInline(str, data, length);
+        return str;
+    }
+
+    //The characters follow the header in the same block
+    CompactString *str = ArenaAllocate(arena, sizeof(CompactString) + length + 1);
+    if (str == NULL) {
+        return NULL;
+    }
+    char *characters = (char *) (str + 1);
+    memcpy(characters, data, length);
+    characters[length] = '\0';
+    str->length = length;
+    str->data = characters;
+    return str;
+}
+
+// === Compact String Creation ===
+CompactString *CompactStringCreate(Arena *arena, const char *data) {
+    return CreateFromRange(arena, data, strlen(data));
+}
+
+int CompactStringInit(Arena *arena, CompactString *str, const char *data, const size_t length) {
+    if (IS_INLINE(length)) {
+        StoreInline(str, data, length);
+        return 0;
+    }
+
+    char *characters = ArenaAllocate(arena, length + 1);
+    if (characters == NULL) {
+        return 1;
+    }
+    memcpy(characters, data, length);
+    characters[length] = '\0';
+    str->length = length;
+    str->data = characters;
+    return 0;
+}
+
+const char *CompactStringGetData(const CompactString *str) {
+    return IS_INLINE(str->length) ? str->inline_data : str->data;
+}
+
+StringView CompactStringGetView(const CompactString *str) {
+    const StringView view = {CompactStringGetData(str), str->length};
+    return view;
+}
+// === Compact String Creation ===
+
+// === Compact String Operations ===
+CompactString *CompactStringGetSubstring(Arena *arena, const CompactString *source, const size_t start, size_t len) {
+    //Same rules as StringGetSubstring: an out of range start is a user error, the length is clamped
+    if (start >= source->length) {
+        return NULL;
+    }
+    if (len > source->length - start) {
+        len = source->length - start;
+    }
+    return CreateFromRange(arena, CompactStringGetData(source) + start, len);
+}
+
+CompactString *CompactStringTokenize(Arena *arena, const CompactString *str, const char delimiter, size_t *count) {
+    const char *text = CompactStringGetData(str);
+    const char *end = text + str->length;
+
+    //First pass: count the tokens and the bytes of the long ones, which share one block
+    size_t token_count = 0, long_bytes = 0;
+    for (const char *start = text;;) {
+        const char *found = memchr(start, delimiter, (size_t) (end - start));
+        const char *token_end = found != NULL ? found : end;
+        const size_t length = (size_t) (token_end - start);
+        if (!IS_INLINE(length)) {
+            long_bytes += length + 1;
+        }
+        token_count++;
+        if (found == NULL) {
+            break;
+        }
+        start = found + 1;
+    }
+
+    CompactString *tokens = ArenaAllocate(arena, token_count * sizeof(CompactString));
+    char *characters = long_bytes > 0 ? ArenaAllocate(arena, long_bytes) : NULL;
+    if (tokens == NULL || (long_bytes > 0 && characters == NULL)) {
+        return NULL;
+    }
+
+    //Second pass: short tokens go inline, long ones are copied to the shared block
+    size_t token_index = 0;
+    for (const char *start = text;;) {
+        const char *found = memchr(start, delimiter, (size_t) (end - start));
+        const char *token_end = found != NULL ? found : end;
+        const size_t length = (size_t) (token_end - start);
+        CompactString *token = &tokens[token_index++];
+        if (IS_INLINE(length)) {
+            StoreInline(token, start, length);
+        }
+        else {
+            memcpy(characters, start, length);
+            characters[length] = '\0';
+            token->length = length;
+            token->data = characters;
+            characters += length + 1;
+        }
+        if (found == NULL) {
+            break;
+        }
+        start = found + 1;
+    }
+
+    *count = token_count;
+    return tokens;
+}
+
+int CompactStringCompare(const CompactString *str1, const CompactString *str2) {
+    if (str1->length != str2->length) {
+        return 1;
+    }
+
+    //Inline buffers are zero padded, so equal strings have equal buffers
+    if (IS_INLINE(str1->length)) {
+        uint64_t words1[2], words2[2];
+        memcpy(words1, str1->inline_data, sizeof words1);
+        memcpy(words2, str2->inline_data, sizeof words2);
+        return ((words1[0] ^ words2[0]) | (words1[1] ^ words2[1])) != 0;
+    }
+    return memcmp(str1->data, str2->data, str1->length) != 0;
+}
+// === Compact String Operations ===
@@ -0,0 +1,100 @@
+/**
+ * @file    CompactString.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Compact string representation with inline short strings and single allocation creation
+ *
+ * A CompactString is 24 bytes. Strings of up to COMPACT_STRING_INLINE_CAPACITY bytes are stored inline in it, so
+ * reading them needs no pointer dereference and an array of them needs no per string allocation. Longer strings
+ * point to their characters, which CompactStringCreate places right after the header in the same allocation.
+ * Both forms are null terminated and the inline buffer is zero padded.
+ */
+
+#ifndef COMPACT_STRING_H
+#define COMPACT_STRING_H
+
+#include "String.h"
+
+/**
+ * @brief                   Longest string which is stored inline.
+ */
+#define COMPACT_STRING_INLINE_CAPACITY 15
+
+/**
+ * @brief                   Compact string. Strings are either inline (length <= COMPACT_STRING_INLINE_CAPACITY)
+ *                          or point to their characters.
+ */
+typedef struct CompactString {
+    size_t length;
+    union {
+        char inline_data[COMPACT_STRING_INLINE_CAPACITY + 1];   //Characters of an inline string, zero padded
+        const char *data;                                       //Characters of a longer string
+    };
+}CompactString;
+
+/**
+ * @brief                   Creates a compact string with a single arena allocation: the header alone for a
+ *                          short string, the header followed by the characters for a longer one.
+ * @param arena             The arena which will contain the string
+ * @param data              The c type string which holds the character data
+ * @return                  The string or NULL on failure
+ */
+CompactString *CompactStringCreate(Arena *arena, const char *data);
+
+/**
+ * @brief                   Initialises a compact string in caller owned storage (e.g. an array element). Short
+ *                          strings need no allocation, the characters of a longer one are copied to the arena.
+ * @param arena             The arena for the characters of a longer string
+ * @param str               The string to initialise
+ * @param data              The characters, they do not need to be null terminated
+ * @param length            The count of the characters
+ * @return                  0 on success, 1 on failure
+ */
+int CompactStringInit(Arena *arena, CompactString *str, const char *data, size_t length);
+
+/**
+ * @brief                   Gets the null terminated characters of a compact string.
+ * @param str               The string
+ * @return                  The characters
+ */
+const char *CompactStringGetData(const CompactString *str);
+
+/**
+ * @brief                   Creates a view of a compact string's characters. The view of an inline string points
+ *                          into the string object, so it is only valid while the object is.
+ * @param str               The string to view
+ * @return                  View of the string
+ */
+StringView CompactStringGetView(const CompactString *str);
+
+/**
+ * @brief                   Gets the substring of a compact string, see StringGetSubstring.
+ * @param arena             The arena to allocate the substring to
+ * @param source            The string to get the substring of
+ * @param start             The start index of the substring
+ * @param len               The length of the substring, clamped to the end of the source
+ * @return                  The substring created with a single allocation, NULL if start is out of range
+ */
+CompactString *CompactStringGetSubstring(Arena *arena, const CompactString *source, size_t start, size_t len);
+
+/**
+ * @brief                   Tokenises a compact string into a contiguous array of compact strings. Short tokens are
+ *                          stored inline in the array, the characters of the longer ones share one block, so the
+ *                          whole result takes two allocations. Empty tokens are kept.
+ * @param arena             The arena to allocate the array and the characters to
+ * @param str               The string to tokenise
+ * @param delimiter         The delimiter to look out for
+ * @param count             The count of the tokens
+ * @return                  The tokens or NULL on failure
+ */
+CompactString *CompactStringTokenize(Arena *arena, const CompactString *str, char delimiter, size_t *count);
+
+/**
+ * @brief                   Compares two compact strings. Inline strings are compared as two words.
+ * @param str1              First string to compare
+ * @param str2              Second string to compare
+ * @return                  0 if the strings are the same, 1 if not
+ */
+int CompactStringCompare(const CompactString *str1, const CompactString *str2);
+
+#endif //COMPACT_STRING_H
@@ -94,6 +94,11 @@ void StringDelete(String *string) {
     free(string);
 }
 
+StringView StringGetView(const String *str) {
+    const StringView view = {str->c_str, str->length};
+    return view;
+}
+
 // === String Creation & Deletion ===
 
 // === String Operations ===
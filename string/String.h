@@ -50,6 +50,22 @@ typedef struct String {
     size_t length;
 }String;
 
+/**
+ *
+ * @brief                   Non-owning view of a character range. The data does not need to be null terminated.
+ */
+typedef struct StringView {
+    const char *data;
+    size_t length;
+}StringView;
+
+/**
+ * @brief                   Creates a view of a string object's characters.
+ * @param str               The string to view
+ * @return                  View of the string
+ */
+StringView StringGetView(const String *str);
+
 /**
  * @brief                   Creates a string object using the provided data.
  * @param arena             The arena which will contain the string. NULL if normal heap allocation is requested
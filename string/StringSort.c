@@ -0,0 +1,551 @@
+/**
+ * @file    StringSort.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   MSD radix sort with cached key prefixes, deduplication and binary search for string arrays
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#include "StringSort.h"
+#include "../vector/Vector.h"
+
+//Buckets smaller than this are insertion sorted
+#define STRING_SORT_INSERTION_THRESHOLD 32
+//One bucket for the keys which ended plus one for every byte value
+#define STRING_SORT_BUCKET_COUNT 257
+#define STRING_SORT_MAX_THREADS 64
+
+/**
+ * @brief                   A key with its cached prefix. `prefix` holds the eight key bytes of the block the
+ *                          current depth is in, big-endian and zero padded, so it compares like the bytes do.
+ */
+typedef struct SortEntry {
+    uint64_t prefix;
+    const char *data;
+    size_t length;
+    const void *item;       //The sorted object (String *), unused for views
+}SortEntry;
+
+/**
+ * @brief                   A bucket of the parallel sort. Its entries share their first `depth` key bytes and
+ *                          their prefixes hold the block of `depth`. It is sorted by the worker `thread`.
+ */
+typedef struct SortTask {
+    size_t start, size;
+    size_t depth;
+    size_t thread;
+}SortTask;
+
+VECTOR_DECLARE(SortTaskVector, SortTask)
+VECTOR_DEFINE(SortTaskVector, SortTask)
+
+/**
+ * @brief                   Work of a parallel sort worker: the tasks whose `thread` field matches its index.
+ */
+typedef struct SortWorker {
+    SortEntry *entries, *scratch;
+    const SortTask *tasks;
+    size_t task_count;
+    size_t index;
+}SortWorker;
+
+// ===== Keys =====
+
+//Loads the eight key bytes starting at depth, big-endian and zero padded
+static uint64_t LoadPrefix(const char *data, const size_t length, const size_t depth) {
+    const unsigned char *bytes = (const unsigned char *) data + depth;
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (depth + 8 <= length) {
+        uint64_t word;
+        memcpy(&word, bytes, sizeof word);
+        return __builtin_bswap64(word);
+    }
+#endif
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; i++) {
+        prefix <<= 8;
+        if (depth + i < length) {
+            prefix |= bytes[i];
+        }
+    }
+    return prefix;
+}
+
+static void RefillPrefixes(SortEntry *entries, const size_t count, const size_t depth) {
+    for (size_t i = 0; i < count; i++) {
+        entries[i].prefix = LoadPrefix(entries[i].data, entries[i].length, depth);
+    }
+}
+
+//Bucket of an entry at the given depth, 0 if its key ended, otherwise the key byte plus one
+static size_t KeyBucket(const SortEntry *entry, const size_t depth) {
+    if (depth >= entry->length) {
+        return 0;
+    }
+    return (size_t) ((entry->prefix >> (56 - 8 * (depth & 7))) & 0xFF) + 1;
+}
+
+//Compares two entries whose keys are equal before depth
+static int CompareEntries(const SortEntry *first, const SortEntry *second, const size_t depth) {
+    //The prefixes hold the current block, so they decide unless the block is equal
+    if (first->prefix != second->prefix) {
+        return first->prefix < second->prefix ? -1 : 1;
+    }
+    const size_t start = (depth & ~(size_t) 7) + 8;
+    const size_t shorter = first->length < second->length ? first->length : second->length;
+    if (shorter > start) {
+        const int result = memcmp(first->data + start, second->data + start, shorter - start);
+        if (result != 0) {
+            return result;
+        }
+    }
+    return (first->length > second->length) - (first->length < second->length);
+}
+// ===== Keys =====
+
+// ===== Radix Sort =====
+static void InsertionSort(SortEntry *entries, const size_t count, const size_t depth) {
+    for (size_t i = 1; i < count; i++) {
+        const SortEntry entry = entries[i];
+        size_t j = i;
+        while (j > 0 && CompareEntries(&entry, &entries[j - 1], depth) < 0) {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+        entries[j] = entry;
+    }
+}
+
+/**
+ * @brief                   Skips the key bytes every entry shares, then distributes the entries by the first byte
+ *                          which differs.
+ * @param entries           The entries, distributed in place
+ * @param scratch           Scratch space for as many entries
+ * @param count             The count of the entries
+ * @param depth             The depth to start at, updated to the depth the entries were distributed at
+ * @param bucket_sizes      Sizes of the STRING_SORT_BUCKET_COUNT buckets
+ * @return                  1 if the entries were distributed, 0 if they are all equal
+ */
+static int Distribute(SortEntry *entries, SortEntry *scratch, const size_t count, size_t *depth,
+                      size_t *bucket_sizes) {
+    for (;;) {
+        memset(bucket_sizes, 0, STRING_SORT_BUCKET_COUNT * sizeof(size_t));
+        for (size_t i = 0; i < count; i++) {
+            bucket_sizes[KeyBucket(&entries[i], *depth)]++;
+        }
+        //Every key ended, they are all equal
+        if (bucket_sizes[0] == count) {
+            return 0;
+        }
+        //Every key has the same byte here, move to the next one without moving the entries
+        const size_t bucket = KeyBucket(&entries[0], *depth);
+        if (bucket_sizes[bucket] != count) {
+            break;
+        }
+        (*depth)++;
+        if ((*depth & 7) == 0) {
+            RefillPrefixes(entries, count, *depth);
+        }
+    }
+
+    size_t offsets[STRING_SORT_BUCKET_COUNT];
+    size_t offset = 0;
+    for (size_t b = 0; b < STRING_SORT_BUCKET_COUNT; b++) {
+        offsets[b] = offset;
+        offset += bucket_sizes[b];
+    }
+    for (size_t i = 0; i < count; i++) {
+        scratch[offsets[KeyBucket(&entries[i], *depth)]++] = entries[i];
+    }
+    memcpy(entries, scratch, count * sizeof(SortEntry));
+    return 1;
+}
+
+static void RadixSort(SortEntry *entries, SortEntry *scratch, size_t count, size_t depth);
+
+//Sorts a bucket one level below the level it was distributed at
+static void SortBucket(SortEntry *entries, SortEntry *scratch, const size_t count, const size_t depth) {
+    if ((depth & 7) == 0) {
+        RefillPrefixes(entries, count, depth);
+    }
+    RadixSort(entries, scratch, count, depth);
+}
+
+static void RadixSort(SortEntry *entries, SortEntry *scratch, const size_t count, size_t depth) {
+    if (count < STRING_SORT_INSERTION_THRESHOLD) {
+        InsertionSort(entries, count, depth);
+        return;
+    }
+
+    size_t bucket_sizes[STRING_SORT_BUCKET_COUNT];
+    if (!Distribute(entries, scratch, count, &depth, bucket_sizes)) {
+        return;
+    }
+
+    //Bucket 0 holds the keys which ended, they are equal and already in place
+    size_t start = bucket_sizes[0];
+    for (size_t b = 1; b < STRING_SORT_BUCKET_COUNT; b++) {
+        if (bucket_sizes[b] > 1) {
+            SortBucket(entries + start, scratch + start, bucket_sizes[b], depth + 1);
+        }
+        start += bucket_sizes[b];
+    }
+}
+// ===== Radix Sort =====
+
+// ===== Parallel Sort =====
+static void RunSortWorker(const SortWorker *worker) {
+    for (size_t i = 0; i < worker->task_count; i++) {
+        const SortTask *task = &worker->tasks[i];
+        if (task->thread == worker->index) {
+            RadixSort(worker->entries + task->start, worker->scratch + task->start, task->size, task->depth);
+        }
+    }
+}
+
+#ifdef _WIN32
+typedef HANDLE SortThread;
+
+static DWORD WINAPI SortThreadMain(LPVOID argument) {
+    RunSortWorker(argument);
+    return 0;
+}
+
+static int SortThreadStart(SortThread *thread, SortWorker *worker) {
+    *thread = CreateThread(NULL, 0, SortThreadMain, worker, 0, NULL);
+    return *thread == NULL;
+}
+
+static void SortThreadJoin(const SortThread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+static size_t GetCpuCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+}
+#else
+typedef pthread_t SortThread;
+
+static void *SortThreadMain(void *argument) {
+    RunSortWorker(argument);
+    return NULL;
+}
+
+static int SortThreadStart(SortThread *thread, SortWorker *worker) {
+    return pthread_create(thread, NULL, SortThreadMain, worker) != 0;
+}
+
+static void SortThreadJoin(const SortThread thread) {
+    pthread_join(thread, NULL);
+}
+
+static size_t GetCpuCount(void) {
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t) count : 1;
+}
+#endif
+
+//Orders tasks by decreasing size
+static int CompareTaskSizes(const void *first, const void *second) {
+    const size_t first_size = ((const SortTask *) first)->size;
+    const size_t second_size = ((const SortTask *) second)->size;
+    return (first_size < second_size) - (first_size > second_size);
+}
+
+/**
+ * @brief                   Distributes a task on the calling thread and queues its buckets as new tasks. Buckets
+ *                          which cannot be queued are sorted right away.
+ * @return                  1 if a bucket could not be queued, 0 otherwise
+ */
+static int SplitTask(SortTaskVector *tasks, SortEntry *entries, SortEntry *scratch, const SortTask task) {
+    size_t depth = task.depth;
+    size_t bucket_sizes[STRING_SORT_BUCKET_COUNT];
+    if (!Distribute(entries + task.start, scratch + task.start, task.size, &depth, bucket_sizes)) {
+        return 0;
+    }
+
+    int failed = 0;
+    size_t start = task.start + bucket_sizes[0];
+    for (size_t b = 1; b < STRING_SORT_BUCKET_COUNT; b++) {
+        const size_t size = bucket_sizes[b];
+        if (size > 1) {
+            if (((depth + 1) & 7) == 0) {
+                RefillPrefixes(entries + start, size, depth + 1);
+            }
+            const SortTask bucket = {start, size, depth + 1, 0};
+            if (SortTaskVectorPush(tasks, bucket) != 0) {
+                RadixSort(entries + start, scratch + start, size, depth + 1);
+                failed = 1;
+            }
+        }
+        start += size;
+    }
+    return failed;
+}
+
+//Splits the input on the calling thread until no bucket holds more than a thread's share, then sorts the buckets
+//on worker threads. Splitting past the first level keeps skewed inputs (e.g. paths which all start with '/')
+//from ending up in a single bucket.
+static void ParallelRadixSort(SortEntry *entries, SortEntry *scratch, const size_t count, size_t thread_count) {
+    SortTaskVector tasks;
+    if (SortTaskVectorInit(&tasks, NULL, STRING_SORT_BUCKET_COUNT) != 0) {
+        RadixSort(entries, scratch, count, 0);
+        return;
+    }
+    size_t share = count / thread_count;
+    if (share < STRING_SORT_INSERTION_THRESHOLD) {
+        share = STRING_SORT_INSERTION_THRESHOLD;
+    }
+
+    const SortTask whole = {0, count, 0, 0};
+    int failed = SplitTask(&tasks, entries, scratch, whole);
+    while (!failed) {
+        size_t largest = 0;
+        for (size_t t = 1; t < tasks.length; t++) {
+            if (tasks.data[t].size > tasks.data[largest].size) {
+                largest = t;
+            }
+        }
+        SortTask task;
+        if (tasks.length == 0 || tasks.data[largest].size <= share ||
+            SortTaskVectorSwapRemove(&tasks, largest, &task) != 0) {
+            break;
+        }
+        failed = SplitTask(&tasks, entries, scratch, task);
+    }
+    //Out of memory, sort what is left on the calling thread
+    if (failed) {
+        for (size_t t = 0; t < tasks.length; t++) {
+            RadixSort(entries + tasks.data[t].start, scratch + tasks.data[t].start, tasks.data[t].size,
+                      tasks.data[t].depth);
+        }
+        SortTaskVectorFree(&tasks);
+        return;
+    }
+
+    if (thread_count > tasks.length) {
+        thread_count = tasks.length;
+    }
+
+    //Hand the largest remaining task to the least loaded thread
+    size_t loads[STRING_SORT_MAX_THREADS] = {0};
+    SortTaskVectorSort(&tasks, CompareTaskSizes);
+    for (size_t n = 0; n < tasks.length; n++) {
+        size_t least_loaded = 0;
+        for (size_t t = 1; t < thread_count; t++) {
+            if (loads[t] < loads[least_loaded]) {
+                least_loaded = t;
+            }
+        }
+        tasks.data[n].thread = least_loaded;
+        loads[least_loaded] += tasks.data[n].size;
+    }
+
+    //Worker 0 runs on the calling thread, a worker whose thread cannot be started runs there as well
+    SortWorker workers[STRING_SORT_MAX_THREADS];
+    SortThread threads[STRING_SORT_MAX_THREADS];
+    int started[STRING_SORT_MAX_THREADS] = {0};
+    for (size_t t = 0; t < thread_count; t++) {
+        workers[t].entries = entries;
+        workers[t].scratch = scratch;
+        workers[t].tasks = tasks.data;
+        workers[t].task_count = tasks.length;
+        workers[t].index = t;
+    }
+    for (size_t t = 1; t < thread_count; t++) {
+        started[t] = SortThreadStart(&threads[t], &workers[t]) == 0;
+    }
+    for (size_t t = 0; t < thread_count; t++) {
+        if (!started[t]) {
+            RunSortWorker(&workers[t]);
+        }
+    }
+    for (size_t t = 1; t < thread_count; t++) {
+        if (started[t]) {
+            SortThreadJoin(threads[t]);
+        }
+    }
+    SortTaskVectorFree(&tasks);
+}
+// ===== Parallel Sort =====
+
+//Sorts the entries with the mode the options ask for
+static void SortEntries(SortEntry *entries, SortEntry *scratch, const size_t count,
+                        const StringSortOptions *options) {
+    size_t thread_count = GetCpuCount();
+    size_t parallel_threshold = STRING_SORT_DEFAULT_PARALLEL_THRESHOLD;
+    if (options != NULL) {
+        if (options->thread_count != 0) {
+            thread_count = options->thread_count;
+        }
+        if (options->parallel_threshold != 0) {
+            parallel_threshold = options->parallel_threshold;
+        }
+    }
+    if (thread_count > STRING_SORT_MAX_THREADS) {
+        thread_count = STRING_SORT_MAX_THREADS;
+    }
+
+    RefillPrefixes(entries, count, 0);
+    if (thread_count > 1 && count >= parallel_threshold) {
+        ParallelRadixSort(entries, scratch, count, thread_count);
+    }
+    else {
+        RadixSort(entries, scratch, count, 0);
+    }
+}
+
+//Allocates the entries and the scratch space as one block
+static SortEntry *AllocateEntries(Arena *arena, const size_t count) {
+    if (count > ((size_t) -1) / (2 * sizeof(SortEntry))) {
+        return NULL;
+    }
+    return ArenaAllocate(arena, 2 * count * sizeof(SortEntry));
+}
+
+int StringViewSort(Arena *arena, StringView *views, const size_t count, const StringSortOptions *options) {
+    if (count < 2) {
+        return 0;
+    }
+
+    //The scratch space is handed back to the arena once the views are written back
+    const size_t saved_offset = arena->offset;
+    SortEntry *entries = AllocateEntries(arena, count);
+    if (entries == NULL) {
+        return 1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        entries[i].data = views[i].data;
+        entries[i].length = views[i].length;
+        entries[i].item = NULL;
+    }
+    SortEntries(entries, entries + count, count, options);
+    for (size_t i = 0; i < count; i++) {
+        views[i].data = entries[i].data;
+        views[i].length = entries[i].length;
+    }
+
+    arena->offset = saved_offset;
+    return 0;
+}
+
+int StringSort(Arena *arena, String **strings, const size_t count, const StringSortOptions *options) {
+    if (count < 2) {
+        return 0;
+    }
+
+    //The scratch space is handed back to the arena once the strings are written back
+    const size_t saved_offset = arena->offset;
+    SortEntry *entries = AllocateEntries(arena, count);
+    if (entries == NULL) {
+        return 1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        entries[i].data = strings[i]->c_str;
+        entries[i].length = strings[i]->length;
+        entries[i].item = strings[i];
+    }
+    SortEntries(entries, entries + count, count, options);
+    for (size_t i = 0; i < count; i++) {
+        strings[i] = (String *) entries[i].item;
+    }
+
+    arena->offset = saved_offset;
+    return 0;
+}
+
+// ===== Sorted Array Utilities =====
+int StringViewCompareOrdered(const StringView first, const StringView second) {
+    const size_t shorter = first.length < second.length ? first.length : second.length;
+    if (shorter > 0) {
+        const int result = memcmp(first.data, second.data, shorter);
+        if (result != 0) {
+            return result;
+        }
+    }
+    return (first.length > second.length) - (first.length < second.length);
+}
+
+size_t StringArrayGetLength(String **strings) {
+    size_t count = 0;
+    while (strings[count] != NULL) {
+        count++;
+    }
+    return count;
+}
+
+size_t StringViewDeduplicate(StringView *views, const size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t unique = 1;
+    for (size_t i = 1; i < count; i++) {
+        if (StringViewCompareOrdered(views[i], views[unique - 1]) != 0) {
+            views[unique++] = views[i];
+        }
+    }
+    return unique;
+}
+
+size_t StringDeduplicate(String **strings, const size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t unique = 1;
+    for (size_t i = 1; i < count; i++) {
+        if (StringCompare(strings[i], strings[unique - 1]) != 0) {
+            strings[unique++] = strings[i];
+        }
+    }
+    return unique;
+}
+
+size_t StringViewBinarySearch(const StringView *views, const size_t count, const StringView key) {
+    size_t low = 0, high = count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (StringViewCompareOrdered(views[middle], key) < 0) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    if (low < count && StringViewCompareOrdered(views[low], key) == 0) {
+        return low;
+    }
+    return STRING_NOT_FOUND;
+}
+
+size_t StringBinarySearch(String **strings, const size_t count, const String *key) {
+    const StringView key_view = StringGetView(key);
+    size_t low = 0, high = count;
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (StringViewCompareOrdered(StringGetView(strings[middle]), key_view) < 0) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    if (low < count && StringCompare(strings[low], key) == 0) {
+        return low;
+    }
+    return STRING_NOT_FOUND;
+}
+// ===== Sorted Array Utilities =====
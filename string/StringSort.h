@@ -0,0 +1,102 @@
+/**
+ * @file    StringSort.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Radix sorting, deduplication and binary search for arrays of strings and string views
+ */
+
+#ifndef STRING_SORT_H
+#define STRING_SORT_H
+
+#include "String.h"
+
+/**
+ * @brief                   Index returned by the search functions when nothing was found.
+ */
+#define STRING_NOT_FOUND ((size_t) -1)
+
+/**
+ * @brief                   Inputs with at least this many strings are sorted in parallel by default.
+ */
+#define STRING_SORT_DEFAULT_PARALLEL_THRESHOLD 65536
+
+/**
+ * @brief                   Options for the sort functions. Zero valued fields fall back to their defaults.
+ */
+typedef struct StringSortOptions {
+    size_t thread_count;            //Worker threads of the parallel mode, defaults to the online CPU count
+    size_t parallel_threshold;      //Minimum count of strings for the parallel mode, (size_t) -1 disables it
+}StringSortOptions;
+
+/**
+ * @brief                   Compares two views in lexicographic byte order. A prefix orders before the longer view.
+ * @param first             First view to compare
+ * @param second            Second view to compare
+ * @return                  Negative if first orders before second, 0 if they are equal, positive otherwise
+ */
+int StringViewCompareOrdered(StringView first, StringView second);
+
+/**
+ * @brief                   Counts the strings of a NULL terminated string array (e.g. StringTokenize's result).
+ * @param strings           The array to count
+ * @return                  The count of the strings before the NULL token
+ */
+size_t StringArrayGetLength(String **strings);
+
+/**
+ * @brief                   Sorts views in lexicographic byte order with an MSD radix sort. The first eight bytes
+ *                          of every key are cached next to it, so the sort only dereferences a key once per eight
+ *                          levels. The scratch space is taken from the arena and handed back before returning.
+ * @param arena             The arena for the scratch space (two arrays of 32 bytes per view)
+ * @param views             The views to sort
+ * @param count             The count of the views
+ * @param options           Sort options, NULL for the defaults
+ * @return                  0 on success, 1 if the scratch space could not be allocated (the views are unchanged)
+ */
+int StringViewSort(Arena *arena, StringView *views, size_t count, const StringSortOptions *options);
+
+/**
+ * @brief                   Sorts an array of string objects, see StringViewSort.
+ * @param arena             The arena for the scratch space
+ * @param strings           The strings to sort
+ * @param count             The count of the strings
+ * @param options           Sort options, NULL for the defaults
+ * @return                  0 on success, 1 if the scratch space could not be allocated (the strings are unchanged)
+ */
+int StringSort(Arena *arena, String **strings, size_t count, const StringSortOptions *options);
+
+/**
+ * @brief                   Removes the adjacent duplicates of a sorted view array in place.
+ * @param views             The sorted views
+ * @param count             The count of the views
+ * @return                  The count of the unique views, which are moved to the front of the array
+ */
+size_t StringViewDeduplicate(StringView *views, size_t count);
+
+/**
+ * @brief                   Removes the adjacent duplicates of a sorted string array in place.
+ * @param strings           The sorted strings
+ * @param count             The count of the strings
+ * @return                  The count of the unique strings, which are moved to the front of the array
+ */
+size_t StringDeduplicate(String **strings, size_t count);
+
+/**
+ * @brief                   Binary searches a sorted view array.
+ * @param views             The sorted views
+ * @param count             The count of the views
+ * @param key               The view to look for
+ * @return                  Index of the first view equal to the key or STRING_NOT_FOUND
+ */
+size_t StringViewBinarySearch(const StringView *views, size_t count, StringView key);
+
+/**
+ * @brief                   Binary searches a sorted string array.
+ * @param strings           The sorted strings
+ * @param count             The count of the strings
+ * @param key               The string to look for
+ * @return                  Index of the first string equal to the key or STRING_NOT_FOUND
+ */
+size_t StringBinarySearch(String **strings, size_t count, const String *key);
+
+#endif //STRING_SORT_H
@@ -0,0 +1,522 @@
+/**
+ * @file    Utf8.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   UTF-8 routines with SIMD fast paths
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Utf8.h"
+#include "../arena/Arena.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+    //The SSSE3 validator is compiled with a target attribute and picked at runtime
+    #define UTF8_HAS_SSSE3 1
+#else
+    #define UTF8_HAS_SSSE3 0
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define UTF8_HAS_SSE2 1
+#else
+    #define UTF8_HAS_SSE2 0
+#endif
+
+//High bit of every byte of a 64 bit word
+#define UTF8_HIGH_BITS 0x8080808080808080ULL
+
+/**
+ * @brief                   A run of code points sharing a fold delta, every `stride`th code point of
+ *                          [start, end] folds to itself plus `delta`.
+ */
+typedef struct Utf8FoldRange {
+    uint32_t start, end;
+    int32_t delta;
+    uint32_t stride;
+}Utf8FoldRange;
+
+//Simple case folding (statuses C and S) of Unicode 14.0, generated from CaseFolding.txt
+static const Utf8FoldRange fold_ranges[] = {
+    {0x00041, 0x0005A, 32, 1}, {0x000B5, 0x000B5, 775, 1}, {0x000C0, 0x000D6, 32, 1},
+    {0x000D8, 0x000DE, 32, 1}, {0x00100, 0x0012E, 1, 2}, {0x00132, 0x00136, 1, 2},
+    {0x00139, 0x00147, 1, 2}, {0x0014A, 0x00176, 1, 2}, {0x00178, 0x00178, -121, 1},
+    {0x00179, 0x0017D, 1, 2}, {0x0017F, 0x0017F, -268, 1}, {0x00181, 0x00181, 210, 1},
+    {0x00182, 0x00184, 1, 2}, {0x00186, 0x00186, 206, 1}, {0x00187, 0x00187, 1, 1},
+    {0x00189, 0x0018A, 205, 1}, {0x0018B, 0x0018B, 1, 1}, {0x0018E, 0x0018E, 79, 1},
+    {0x0018F, 0x0018F, 202, 1}, {0x00190, 0x00190, 203, 1}, {0x00191, 0x00191, 1, 1},
+    {0x00193, 0x00193, 205, 1}, {0x00194, 0x00194, 207, 1}, {0x00196, 0x00196, 211, 1},
+    {0x00197, 0x00197, 209, 1}, {0x00198, 0x00198, 1, 1}, {0x0019C, 0x0019C, 211, 1},
+    {0x0019D, 0x0019D, 213, 1}, {0x0019F, 0x0019F, 214, 1}, {0x001A0, 0x001A4, 1, 2},
+    {0x001A6, 0x001A6, 218, 1}, {0x001A7, 0x001A7, 1, 1}, {0x001A9, 0x001A9, 218, 1},
+    {0x001AC, 0x001AC, 1, 1}, {0x001AE, 0x001AE, 218, 1}, {0x001AF, 0x001AF, 1, 1},
+    {0x001B1, 0x001B2, 217, 1}, {0x001B3, 0x001B5, 1, 2}, {0x001B7, 0x001B7, 219, 1},
+    {0x001B8, 0x001B8, 1, 1}, {0x001BC, 0x001BC, 1, 1}, {0x001C4, 0x001C4, 2, 1},
+    {0x001C5, 0x001C5, 1, 1}, {0x001C7, 0x001C7, 2, 1}, {0x001C8, 0x001C8, 1, 1},
+    {0x001CA, 0x001CA, 2, 1}, {0x001CB, 0x001DB, 1, 2}, {0x001DE, 0x001EE, 1, 2},
+    {0x001F1, 0x001F1, 2, 1}, {0x001F2, 0x001F4, 1, 2}, {0x001F6, 0x001F6, -97, 1},
+    {0x001F7, 0x001F7, -56, 1}, {0x001F8, 0x0021E, 1, 2}, {0x00220, 0x00220, -130, 1},
+    {0x00222, 0x00232, 1, 2}, {0x0023A, 0x0023A, 10795, 1}, {0x0023B, 0x0023B, 1, 1},
+    {0x0023D, 0x0023D, -163, 1}, {0x0023E, 0x0023E, 10792, 1}, {0x00241, 0x00241, 1, 1},
+    {0x00243, 0x00243, -195, 1}, {0x00244, 0x00244, 69, 1}, {0x00245, 0x00245, 71, 1},
+    {0x00246, 0x0024E, 1, 2}, {0x00345, 0x00345, 116, 1}, {0x00370, 0x00372, 1, 2},
+    {0x00376, 0x00376, 1, 1}, {0x0037F, 0x0037F, 116, 1}, {0x00386, 0x00386, 38, 1},
+    {0x00388, 0x0038A, 37, 1}, {0x0038C, 0x0038C, 64, 1}, {0x0038E, 0x0038F, 63, 1},
+    {0x00391, 0x003A1, 32, 1}, {0x003A3, 0x003AB, 32, 1}, {0x003C2, 0x003C2, 1, 1},
+    {0x003CF, 0x003CF, 8, 1}, {0x003D0, 0x003D0, -30, 1}, {0x003D1, 0x003D1, -25, 1},
+    {0x003D5, 0x003D5, -15, 1}, {0x003D6, 0x003D6, -22, 1}, {0x003D8, 0x003EE, 1, 2},
+    {0x003F0, 0x003F0, -54, 1}, {0x003F1, 0x003F1, -48, 1}, {0x003F4, 0x003F4, -60, 1},
+    {0x003F5, 0x003F5, -64, 1}, {0x003F7, 0x003F7, 1, 1}, {0x003F9, 0x003F9, -7, 1},
+    {0x003FA, 0x003FA, 1, 1}, {0x003FD, 0x003FF, -130, 1}, {0x00400, 0x0040F, 80, 1},
+    {0x00410, 0x0042F, 32, 1}, {0x00460, 0x00480, 1, 2}, {0x0048A, 0x004BE, 1, 2},
+    {0x004C0, 0x004C0, 15, 1}, {0x004C1, 0x004CD, 1, 2}, {0x004D0, 0x0052E, 1, 2},
+    {0x00531, 0x00556, 48, 1}, {0x010A0, 0x010C5, 7264, 1}, {0x010C7, 0x010C7, 7264, 1},
+    {0x010CD, 0x010CD, 7264, 1}, {0x013F8, 0x013FD, -8, 1}, {0x01C80, 0x01C80, -6222, 1},
+    {0x01C81, 0x01C81, -6221, 1}, {0x01C82, 0x01C82, -6212, 1}, {0x01C83, 0x01C84, -6210, 1},
+    {0x01C85, 0x01C85, -6211, 1}, {0x01C86, 0x01C86, -6204, 1}, {0x01C87, 0x01C87, -6180, 1},
+    {0x01C88, 0x01C88, 35267, 1}, {0x01C90, 0x01CBA, -3008, 1}, {0x01CBD, 0x01CBF, -3008, 1},
+    {0x01E00, 0x01E94, 1, 2}, {0x01E9B, 0x01E9B, -58, 1}, {0x01E9E, 0x01E9E, -7615, 1},
+    {0x01EA0, 0x01EFE, 1, 2}, {0x01F08, 0x01F0F, -8, 1}, {0x01F18, 0x01F1D, -8, 1},
+    {0x01F28, 0x01F2F, -8, 1}, {0x01F38, 0x01F3F, -8, 1}, {0x01F48, 0x01F4D, -8, 1},
+    {0x01F59, 0x01F5F, -8, 2}, {0x01F68, 0x01F6F, -8, 1}, {0x01F88, 0x01F8F, -8, 1},
+    {0x01F98, 0x01F9F, -8, 1}, {0x01FA8, 0x01FAF, -8, 1}, {0x01FB8, 0x01FB9, -8, 1},
+    {0x01FBA, 0x01FBB, -74, 1}, {0x01FBC, 0x01FBC, -9, 1}, {0x01FBE, 0x01FBE, -7173, 1},
+    {0x01FC8, 0x01FCB, -86, 1}, {0x01FCC, 0x01FCC, -9, 1}, {0x01FD8, 0x01FD9, -8, 1},
+    {0x01FDA, 0x01FDB, -100, 1}, {0x01FE8, 0x01FE9, -8, 1}, {0x01FEA, 0x01FEB, -112, 1},
+    {0x01FEC, 0x01FEC, -7, 1}, {0x01FF8, 0x01FF9, -128, 1}, {0x01FFA, 0x01FFB, -126, 1},
+    {0x01FFC, 0x01FFC, -9, 1}, {0x02126, 0x02126, -7517, 1}, {0x0212A, 0x0212A, -8383, 1},
+    {0x0212B, 0x0212B, -8262, 1}, {0x02132, 0x02132, 28, 1}, {0x02160, 0x0216F, 16, 1},
+    {0x02183, 0x02183, 1, 1}, {0x024B6, 0x024CF, 26, 1}, {0x02C00, 0x02C2F, 48, 1},
+    {0x02C60, 0x02C60, 1, 1}, {0x02C62, 0x02C62, -10743, 1}, {0x02C63, 0x02C63, -3814, 1},
+    {0x02C64, 0x02C64, -10727, 1}, {0x02C67, 0x02C6B, 1, 2}, {0x02C6D, 0x02C6D, -10780, 1},
+    {0x02C6E, 0x02C6E, -10749, 1}, {0x02C6F, 0x02C6F, -10783, 1}, {0x02C70, 0x02C70, -10782, 1},
+    {0x02C72, 0x02C72, 1, 1}, {0x02C75, 0x02C75, 1, 1}, {0x02C7E, 0x02C7F, -10815, 1},
+    {0x02C80, 0x02CE2, 1, 2}, {0x02CEB, 0x02CED, 1, 2}, {0x02CF2, 0x02CF2, 1, 1},
+    {0x0A640, 0x0A66C, 1, 2}, {0x0A680, 0x0A69A, 1, 2}, {0x0A722, 0x0A72E, 1, 2},
+    {0x0A732, 0x0A76E, 1, 2}, {0x0A779, 0x0A77B, 1, 2}, {0x0A77D, 0x0A77D, -35332, 1},
+    {0x0A77E, 0x0A786, 1, 2}, {0x0A78B, 0x0A78B, 1, 1}, {0x0A78D, 0x0A78D, -42280, 1},
+    {0x0A790, 0x0A792, 1, 2}, {0x0A796, 0x0A7A8, 1, 2}, {0x0A7AA, 0x0A7AA, -42308, 1},
+    {0x0A7AB, 0x0A7AB, -42319, 1}, {0x0A7AC, 0x0A7AC, -42315, 1}, {0x0A7AD, 0x0A7AD, -42305, 1},
+    {0x0A7AE, 0x0A7AE, -42308, 1}, {0x0A7B0, 0x0A7B0, -42258, 1}, {0x0A7B1, 0x0A7B1, -42282, 1},
+    {0x0A7B2, 0x0A7B2, -42261, 1}, {0x0A7B3, 0x0A7B3, 928, 1}, {0x0A7B4, 0x0A7C2, 1, 2},
+    {0x0A7C4, 0x0A7C4, -48, 1}, {0x0A7C5, 0x0A7C5, -42307, 1}, {0x0A7C6, 0x0A7C6, -35384, 1},
+    {0x0A7C7, 0x0A7C9, 1, 2}, {0x0A7D0, 0x0A7D0, 1, 1}, {0x0A7D6, 0x0A7D8, 1, 2},
+    {0x0A7F5, 0x0A7F5, 1, 1}, {0x0AB70, 0x0ABBF, -38864, 1}, {0x0FF21, 0x0FF3A, 32, 1},
+    {0x10400, 0x10427, 40, 1}, {0x104B0, 0x104D3, 40, 1}, {0x10570, 0x1057A, 39, 1},
+    {0x1057C, 0x1058A, 39, 1}, {0x1058C, 0x10592, 39, 1}, {0x10594, 0x10595, 39, 1},
+    {0x10C80, 0x10CB2, 64, 1}, {0x118A0, 0x118BF, 32, 1}, {0x16E40, 0x16E5F, 32, 1},
+    {0x1E900, 0x1E921, 34, 1},
+};
+
+static size_t PopCount64(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t) __builtin_popcountll(word);
+#else
+    size_t count = 0;
+    while (word != 0) {
+        word &= word - 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+//Loads 8 bytes without alignment requirements
+static uint64_t LoadWord(const unsigned char *data) {
+    uint64_t word;
+    memcpy(&word, data, sizeof word);
+    return word;
+}
+
+//High bit set in every byte of the word which is a continuation byte (10xxxxxx)
+static uint64_t ContinuationBytes(const uint64_t word) {
+    return word & ~(word << 1) & UTF8_HIGH_BITS;
+}
+
+/**
+ * @brief                   Decodes one code point.
+ * @param data              The bytes to decode
+ * @param length            The count of the available bytes
+ * @param code_point        The decoded code point
+ * @return                  The length of the sequence or 0 if it is invalid or truncated
+ */
+static size_t Utf8Decode(const unsigned char *data, const size_t length, uint32_t *code_point) {
+    const unsigned char lead = data[0];
+    size_t sequence_length;
+    uint32_t value, minimum;
+
+    if (lead < 0x80) {
+        *code_point = lead;
+        return 1;
+    }
+    if ((lead & 0xE0) == 0xC0) {
+        sequence_length = 2;
+        value = lead & 0x1F;
+        minimum = 0x80;
+    }
+    else if ((lead & 0xF0) == 0xE0) {
+        sequence_length = 3;
+        value = lead & 0x0F;
+        minimum = 0x800;
+    }
+    else if ((lead & 0xF8) == 0xF0) {
+        sequence_length = 4;
+        value = lead & 0x07;
+        minimum = 0x10000;
+    }
+    else {
+        return 0;
+    }
+
+    if (sequence_length > length) {
+        return 0;
+    }
+    for (size_t i = 1; i < sequence_length; i++) {
+        if ((data[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        value = (value << 6) | (data[i] & 0x3F);
+    }
+
+    //Reject overlong forms, surrogates and values past the Unicode range
+    if (value < minimum || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+        return 0;
+    }
+    *code_point = value;
+    return sequence_length;
+}
+
+//Encodes a code point, returns the length of the sequence
+static size_t Utf8Encode(const uint32_t code_point, unsigned char *out) {
+    if (code_point < 0x80) {
+        out[0] = (unsigned char) code_point;
+        return 1;
+    }
+    if (code_point < 0x800) {
+        out[0] = (unsigned char) (0xC0 | (code_point >> 6));
+        out[1] = (unsigned char) (0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        out[0] = (unsigned char) (0xE0 | (code_point >> 12));
+        out[1] = (unsigned char) (0x80 | ((code_point >> 6) & 0x3F));
+        out[2] = (unsigned char) (0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    out[0] = (unsigned char) (0xF0 | (code_point >> 18));
+    out[1] = (unsigned char) (0x80 | ((code_point >> 12) & 0x3F));
+    out[2] = (unsigned char) (0x80 | ((code_point >> 6) & 0x3F));
+    out[3] = (unsigned char) (0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+// ===== Validation =====
+static int Utf8IsValidScalar(const unsigned char *data, const size_t length) {
+    size_t i = 0;
+    while (i < length) {
+        //Skip ASCII eight bytes at a time
+        if (i + 8 <= length && (LoadWord(data + i) & UTF8_HIGH_BITS) == 0) {
+            i += 8;
+            continue;
+        }
+        uint32_t code_point;
+        const size_t sequence_length = Utf8Decode(data + i, length - i, &code_point);
+        if (sequence_length == 0) {
+            return 0;
+        }
+        i += sequence_length;
+    }
+    return 1;
+}
+
+#if UTF8_HAS_SSSE3
+/*
+ * Lookup table validation (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte").
+ * Every pair of adjacent bytes is classified with three 16 entry table lookups, one on the high nibble of the
+ * first byte, one on its low nibble and one on the high nibble of the second byte. The AND of the three lookups
+ * is non-zero exactly for the invalid pairs, apart from the third and fourth bytes of long sequences which
+ * are checked separately.
+ */
+#define UTF8_TOO_SHORT      (1 << 0)    //A lead byte followed by a lead byte or ASCII
+#define UTF8_TOO_LONG       (1 << 1)    //ASCII followed by a continuation byte
+#define UTF8_OVERLONG_3     (1 << 2)
+#define UTF8_TOO_LARGE      (1 << 3)
+#define UTF8_SURROGATE      (1 << 4)
+#define UTF8_OVERLONG_2     (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4     (1 << 6)
+#define UTF8_TWO_CONTS      (1 << 7)    //Two continuation bytes, only valid as part of a 3 or 4 byte sequence
+#define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+__attribute__((target("ssse3")))
+static __m128i Utf8HighNibbles(const __m128i input) {
+    return _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F));
+}
+
+__attribute__((target("ssse3")))
+static __m128i Utf8CheckSpecialCases(const __m128i input, const __m128i previous1) {
+    const __m128i byte_1_high_table = _mm_setr_epi8(
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+        UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+        UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+        UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4);
+    const __m128i byte_1_low_table = _mm_setr_epi8(
+        UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+        UTF8_CARRY | UTF8_OVERLONG_2,
+        UTF8_CARRY,
+        UTF8_CARRY,
+        UTF8_CARRY | UTF8_TOO_LARGE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+        UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000);
+    const __m128i byte_2_high_table = _mm_setr_epi8(
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+        UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+
+    const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, Utf8HighNibbles(previous1));
+    const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(previous1, _mm_set1_epi8(0x0F)));
+    const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, Utf8HighNibbles(input));
+    return _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+}
+
+//Checks a 16 byte block, carrying the previous block and its incomplete sequence state
+__attribute__((target("ssse3")))
+static void Utf8CheckBlock(const __m128i input, __m128i *previous_input, __m128i *previous_incomplete,
+                           __m128i *error) {
+    //An ASCII block is valid on its own, it only has to close a sequence left open by the previous block
+    if (_mm_movemask_epi8(input) == 0) {
+        *error = _mm_or_si128(*error, *previous_incomplete);
+        *previous_incomplete = _mm_setzero_si128();
+        *previous_input = input;
+        return;
+    }
+
+    const __m128i previous1 = _mm_alignr_epi8(input, *previous_input, 15);
+    const __m128i previous2 = _mm_alignr_epi8(input, *previous_input, 14);
+    const __m128i previous3 = _mm_alignr_epi8(input, *previous_input, 13);
+    const __m128i special_cases = Utf8CheckSpecialCases(input, previous1);
+
+    //Bytes two and three positions after a 3 or 4 byte lead must be continuation bytes (the TWO_CONTS case)
+    const __m128i is_third_byte = _mm_subs_epu8(previous2, _mm_set1_epi8((char) (0xE0 - 0x80)));
+    const __m128i is_fourth_byte = _mm_subs_epu8(previous3, _mm_set1_epi8((char) (0xF0 - 0x80)));
+    const __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+                                                       _mm_set1_epi8((char) 0x80));
+    *error = _mm_or_si128(*error, _mm_xor_si128(must_be_continuation, special_cases));
+
+    //A lead byte in the last three bytes which needs more bytes than the block has left
+    const __m128i max_value = _mm_setr_epi8(
+        (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF,
+        (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF, (char) 0xFF,
+        (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+    *previous_incomplete = _mm_subs_epu8(input, max_value);
+    *previous_input = input;
+}
+
+__attribute__((target("ssse3")))
+static int Utf8IsValidSsse3(const unsigned char *data, const size_t length) {
+    __m128i previous_input = _mm_setzero_si128();
+    __m128i previous_incomplete = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        Utf8CheckBlock(_mm_loadu_si128((const __m128i *) (data + i)), &previous_input, &previous_incomplete, &error);
+    }
+
+    //The tail is padded with zeros, which are ASCII and end any open sequence with an error
+    if (i < length) {
+        unsigned char tail[16] = {0};
+        memcpy(tail, data + i, length - i);
+        Utf8CheckBlock(_mm_loadu_si128((const __m128i *) tail), &previous_input, &previous_incomplete, &error);
+    }
+    error = _mm_or_si128(error, previous_incomplete);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+#endif
+
+int Utf8IsValid(const char *data, const size_t length) {
+#if UTF8_HAS_SSSE3
+    //Resolved on the first call, the result never changes so a race only repeats the check
+    static int has_ssse3 = -1;
+    if (has_ssse3 < 0) {
+        has_ssse3 = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    if (has_ssse3) {
+        return Utf8IsValidSsse3((const unsigned char *) data, length);
+    }
+#endif
+    return Utf8IsValidScalar((const unsigned char *) data, length);
+}
+// ===== Validation =====
+
+// ===== Counting =====
+size_t Utf8CountCodePoints(const char *data, const size_t length) {
+    const unsigned char *bytes = (const unsigned char *) data;
+    size_t count = 0, i = 0;
+
+#if UTF8_HAS_SSE2
+    //Continuation bytes are 0x80-0xBF, i.e. -128 to -65 as signed bytes, everything else starts a code point
+    const __m128i threshold = _mm_set1_epi8(-65);
+    for (; i + 16 <= length; i += 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i *) (bytes + i));
+        count += PopCount64((uint64_t) _mm_movemask_epi8(_mm_cmpgt_epi8(input, threshold)));
+    }
+#endif
+    for (; i + 8 <= length; i += 8) {
+        count += 8 - PopCount64(ContinuationBytes(LoadWord(bytes + i)));
+    }
+    for (; i < length; i++) {
+        count += (bytes[i] & 0xC0) != 0x80;
+    }
+    return count;
+}
+
+size_t Utf8GetByteOffset(const char *data, const size_t length, size_t index) {
+    const unsigned char *bytes = (const unsigned char *) data;
+    size_t i = 0;
+
+    //Skip whole words while the code point is past them
+    for (; i + 8 <= length; i += 8) {
+        const size_t starts = 8 - PopCount64(ContinuationBytes(LoadWord(bytes + i)));
+        if (starts > index) {
+            break;
+        }
+        index -= starts;
+    }
+    //Find the code point's lead byte in the remaining bytes
+    for (; i < length; i++) {
+        if ((bytes[i] & 0xC0) != 0x80) {
+            if (index == 0) {
+                return i;
+            }
+            index--;
+        }
+    }
+    return index == 0 ? length : UTF8_INVALID_OFFSET;
+}
+// ===== Counting =====
+
+// ===== Case Folding =====
+uint32_t Utf8FoldCodePoint(const uint32_t code_point) {
+    if (code_point < 0x80) {
+        return code_point >= 'A' && code_point <= 'Z' ? code_point + ('a' - 'A') : code_point;
+    }
+
+    //Binary search the last range starting at or before the code point
+    size_t low = 0, high = sizeof fold_ranges / sizeof fold_ranges[0];
+    while (low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if (fold_ranges[middle].start <= code_point) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    if (low == 0) {
+        return code_point;
+    }
+    const Utf8FoldRange *range = &fold_ranges[low - 1];
+    if (code_point > range->end || (code_point - range->start) % range->stride != 0) {
+        return code_point;
+    }
+    return (uint32_t) ((int32_t) code_point + range->delta);
+}
+
+//Lower cases the ASCII letters of a word which only contains ASCII
+static uint64_t FoldAsciiWord(const uint64_t word) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    //High bit set in the bytes >= 'A' and in the bytes > 'Z'
+    const uint64_t at_least_a = word + ones * (0x80 - 'A');
+    const uint64_t above_z = word + ones * (0x7F - 'Z');
+    const uint64_t is_upper = at_least_a & ~above_z & UTF8_HIGH_BITS;
+    //0x80 >> 2 is 0x20, the difference between the cases
+    return word | (is_upper >> 2);
+}
+
+String *StringCaseFold(Arena *arena, const String *str) {
+    const unsigned char *source = (const unsigned char *) str->c_str;
+    const size_t length = str->length;
+
+    //Folding grows a sequence by at most half (2 byte sequences folding to 3 byte ones)
+    const size_t capacity = length + length / 2 + 1;
+    String *result = ArenaAllocate(arena, sizeof(String));
+    unsigned char *out = ArenaAllocate(arena, capacity);
+    if (result == NULL || out == NULL) {
+        return NULL;
+    }
+
+    size_t i = 0, out_length = 0;
+    while (i < length) {
+        //ASCII fast path
+        if (i + 8 <= length) {
+            const uint64_t word = LoadWord(source + i);
+            if ((word & UTF8_HIGH_BITS) == 0) {
+                const uint64_t folded = FoldAsciiWord(word);
+                memcpy(out + out_length, &folded, sizeof folded);
+                i += 8;
+                out_length += 8;
+                continue;
+            }
+        }
+
+        uint32_t code_point;
+        const size_t sequence_length = Utf8Decode(source + i, length - i, &code_point);
+        if (sequence_length == 0) {
+            out[out_length++] = source[i++];
+            continue;
+        }
+        out_length += Utf8Encode(Utf8FoldCodePoint(code_point), out + out_length);
+        i += sequence_length;
+    }
+    out[out_length] = '\0';
+
+    //The data is the arena's last allocation, so the unused tail is given back in place
+    result->c_str = ArenaReallocate(arena, out, capacity, out_length + 1);
+    result->length = out_length;
+    return result;
+}
+// ===== Case Folding =====
+
+// ===== Iteration =====
+Utf8Iterator Utf8IteratorCreate(const StringView view) {
+    const Utf8Iterator iterator = {view, 0};
+    return iterator;
+}
+
+int Utf8IteratorNext(Utf8Iterator *iterator, uint32_t *code_point) {
+    if (iterator->offset >= iterator->view.length) {
+        return 0;
+    }
+    const unsigned char *bytes = (const unsigned char *) iterator->view.data + iterator->offset;
+    const size_t sequence_length = Utf8Decode(bytes, iterator->view.length - iterator->offset, code_point);
+    if (sequence_length == 0) {
+        *code_point = UTF8_REPLACEMENT_CHARACTER;
+        iterator->offset++;
+    }
+    else {
+        iterator->offset += sequence_length;
+    }
+    return 1;
+}
+// ===== Iteration =====
@@ -0,0 +1,93 @@
+/**
+ * @file    Utf8.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   UTF-8 validation, code point counting, case folding and iteration
+ */
+
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <stdint.h>
+#include "String.h"
+
+/**
+ * @brief                   Offset returned by Utf8GetByteOffset when the index is past the end.
+ */
+#define UTF8_INVALID_OFFSET ((size_t) -1)
+
+/**
+ * @brief                   Code point produced by the iterator for an invalid byte.
+ */
+#define UTF8_REPLACEMENT_CHARACTER 0xFFFD
+
+/**
+ * @brief                   Iterator over the code points of a view.
+ */
+typedef struct Utf8Iterator {
+    StringView view;
+    size_t offset;          //Byte offset of the next code point
+}Utf8Iterator;
+
+/**
+ * @brief                   Checks whether the given bytes are well-formed UTF-8 (no overlong forms, surrogates or
+ *                          code points past U+10FFFF). Uses the SSSE3 lookup table algorithm when the CPU supports
+ *                          it and a scalar decoder otherwise.
+ * @param data              The bytes to check
+ * @param length            The count of the bytes
+ * @return                  1 for valid 0 for not
+ */
+int Utf8IsValid(const char *data, size_t length);
+
+/**
+ * @brief                   Counts the code points of valid UTF-8 data (i.e. the bytes which are not continuation
+ *                          bytes).
+ * @param data              The UTF-8 data
+ * @param length            The count of the bytes
+ * @return                  The count of the code points
+ */
+size_t Utf8CountCodePoints(const char *data, size_t length);
+
+/**
+ * @brief                   Maps a code point index to the byte offset of that code point in valid UTF-8 data.
+ * @param data              The UTF-8 data
+ * @param length            The count of the bytes
+ * @param index             Index of the code point
+ * @return                  The byte offset, `length` if the index equals the code point count,
+ *                          UTF8_INVALID_OFFSET if it is greater
+ */
+size_t Utf8GetByteOffset(const char *data, size_t length, size_t index);
+
+/**
+ * @brief                   Applies Unicode simple case folding (CaseFolding.txt statuses C and S) to a code point.
+ * @param code_point        The code point to fold
+ * @return                  The folded code point
+ */
+uint32_t Utf8FoldCodePoint(uint32_t code_point);
+
+/**
+ * @brief                   Creates the simple case folded copy of a string. ASCII runs are folded eight bytes at
+ *                          a time. Invalid bytes are copied unchanged.
+ * @param arena             The arena to allocate the new string to
+ * @param str               The string to fold
+ * @return                  The folded string or NULL on failure
+ */
+String *StringCaseFold(Arena *arena, const String *str);
+
+/**
+ * @brief                   Creates an iterator positioned at the start of the view.
+ * @param view              The view to iterate over
+ * @return                  The iterator
+ */
+Utf8Iterator Utf8IteratorCreate(StringView view);
+
+/**
+ * @brief                   Reads the next code point. Invalid bytes are returned as UTF8_REPLACEMENT_CHARACTER,
+ *                          one byte at a time.
+ * @param iterator          The iterator to advance
+ * @param code_point        The code point read
+ * @return                  1 if a code point was read, 0 at the end of the view
+ */
+int Utf8IteratorNext(Utf8Iterator *iterator, uint32_t *code_point);
+
+#endif //UTF8_H
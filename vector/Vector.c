@@ -0,0 +1,60 @@
+/**
+ * @file    Vector.c
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Untyped growth logic shared by every generated vector type
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Vector.h"
+#include "../log/Log.h"
+
+//Smallest capacity a vector grows to, so that the first pushes do not reallocate one by one
+#define VECTOR_MIN_CAPACITY 8
+
+int VectorGrow(void **data, size_t *capacity, Arena *arena, const size_t element_size, const size_t min_capacity) {
+    //Double the capacity, or jump straight to the requested one if that is larger
+    size_t new_capacity = *capacity < VECTOR_MIN_CAPACITY ? VECTOR_MIN_CAPACITY : *capacity;
+    while (new_capacity < min_capacity) {
+        if (new_capacity > (size_t) -1 / 2) {
+            new_capacity = min_capacity;
+            break;
+        }
+        new_capacity *= 2;
+    }
+
+    //Check for overflow of the byte size
+    if (new_capacity > (size_t) -1 / element_size) {
+        char message_buffer[100];
+        snprintf(message_buffer, sizeof message_buffer,
+                 "Vector capacity overflow, requested %zu elements of %zu bytes\n", min_capacity, element_size);
+        Log(ERROR, message_buffer);
+        return 1;
+    }
+
+    void *new_data;
+    if (arena != NULL) {
+        //Grows in place if the block is the arena's last allocation, otherwise copies it
+        new_data = ArenaReallocate(arena, *data, *capacity * element_size, new_capacity * element_size);
+    }
+    else {
+        new_data = realloc(*data, new_capacity * element_size);
+    }
+
+    if (new_data == NULL) {
+        return 1;
+    }
+
+    *data = new_data;
+    *capacity = new_capacity;
+    return 0;
+}
+
+void VectorFreeBlock(void *data, Arena *arena) {
+    //Arena blocks are reclaimed with the arena itself
+    if (arena == NULL) {
+        free(data);
+    }
+}
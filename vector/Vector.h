@@ -0,0 +1,216 @@
+/**
+ * @file    Vector.h
+ * @author  Tarık Eren Tosun
+ * @date    19 Oct 2026
+ * @brief   Macro generated, type-safe dynamic array which grows on the heap or in an arena
+ *
+ * Elements are stored inline in one contiguous block. A vector type is generated with two macros:
+ *
+ *      //In a header
+ *      VECTOR_DECLARE(IntVector, int)
+ *      //In exactly one source file
+ *      VECTOR_DEFINE(IntVector, int)
+ *
+ * which creates the `IntVector` struct and the `IntVectorInit`, `IntVectorPush`... functions documented below.
+ * A vector with an arena grows in place as long as its block is the arena's last allocation, otherwise the
+ * block is copied and the old one is left to the arena. Without an arena the vector uses malloc and realloc.
+ */
+
+#ifndef VECTOR_H
+#define VECTOR_H
+
+#include <stdlib.h>
+#include "../arena/Arena.h"
+#include "../string/String.h"
+
+/**
+ * @brief                   Index returned by the search functions when nothing was found.
+ */
+#define VECTOR_NOT_FOUND ((size_t) -1)
+
+/**
+ * @brief                   Grows an untyped vector block so that it holds at least `min_capacity` elements.
+ *                          The capacity is at least doubled so that repeated pushes are amortised O(1).
+ *                          Used by the generated functions, not meant to be called directly.
+ * @param data              Address of the block pointer, updated on success
+ * @param capacity          Address of the capacity in elements, updated on success
+ * @param arena             The arena to grow in, NULL for the heap
+ * @param element_size      Size of one element
+ * @param min_capacity      The minimum capacity required
+ * @return                  0 on success, 1 on failure (the block is left unchanged)
+ */
+int VectorGrow(void **data, size_t *capacity, Arena *arena, size_t element_size, size_t min_capacity);
+
+/**
+ * @brief                   Frees an untyped vector block if it was heap allocated.
+ * @param data              The block
+ * @param arena             The arena the block belongs to, NULL for the heap
+ */
+void VectorFreeBlock(void *data, Arena *arena);
+
+/**
+ * @brief                   Declares a vector type and its functions.
+ * @param Name              Name of the vector type, the functions are prefixed with it
+ * @param Type              Element type
+ *
+ * int Name##Init(Name *vector, Arena *arena, size_t capacity)
+ *      Initialises an empty vector with room for `capacity` elements. `arena` is NULL for heap storage.
+ * void Name##Free(Name *vector)
+ *      Frees heap storage (arena storage is reclaimed with the arena) and empties the vector.
+ * int Name##Reserve(Name *vector, size_t capacity)
+ *      Makes room for at least `capacity` elements.
+ * int Name##Push(Name *vector, Type value)
+ *      Appends an element.
+ * int Name##Insert(Name *vector, size_t index, Type value)
+ *      Inserts an element before `index`, shifting the following elements. `index` may equal the length.
+ * int Name##Append(Name *vector, const Type *items, size_t count)
+ *      Appends `count` elements with a single copy.
+ * int Name##Pop(Name *vector, Type *removed)
+ *      Removes the last element and stores it to `removed` unless it is NULL. Fails on an empty vector.
+ * int Name##SwapRemove(Name *vector, size_t index, Type *removed)
+ *      Removes the element at `index` in O(1) by moving the last element into its place and stores it to
+ *      `removed` unless it is NULL. `index` must be less than the length.
+ * void Name##Sort(Name *vector, int (*compare)(const void *, const void *))
+ *      Sorts the elements with a qsort compatible comparator.
+ * size_t Name##LowerBound(const Name *vector, const Type *key, int (*compare)(const void *, const void *))
+ *      Index of the first element not less than `key` in a sorted vector (the length if there is none).
+ * size_t Name##BinarySearch(const Name *vector, const Type *key, int (*compare)(const void *, const void *))
+ *      Index of an element equal to `key` in a sorted vector or VECTOR_NOT_FOUND.
+ *
+ * The functions returning int return 0 on success and 1 on failure (allocation failure or a bad index).
+ */
+#define VECTOR_DECLARE(Name, Type)                                                                                 \
+    typedef struct Name {                                                                                          \
+        Type *data;                                                                                                \
+        size_t length, capacity;                                                                                   \
+        Arena *arena;                                                                                              \
+    }Name;                                                                                                         \
+    int Name##Init(Name *vector, Arena *arena, size_t capacity);                                                   \
+    void Name##Free(Name *vector);                                                                                 \
+    int Name##Reserve(Name *vector, size_t capacity);                                                              \
+    int Name##Push(Name *vector, Type value);                                                                      \
+    int Name##Insert(Name *vector, size_t index, Type value);                                                      \
+    int Name##Append(Name *vector, const Type *items, size_t count);                                               \
+    int Name##Pop(Name *vector, Type *removed);                                                                    \
+    int Name##SwapRemove(Name *vector, size_t index, Type *removed);                                               \
+    void Name##Sort(Name *vector, int (*compare)(const void *, const void *));                                     \
+    size_t Name##LowerBound(const Name *vector, const Type *key, int (*compare)(const void *, const void *));      \
+    size_t Name##BinarySearch(const Name *vector, const Type *key, int (*compare)(const void *, const void *));
+
+/**
+ * @brief                   Defines the functions declared by VECTOR_DECLARE. Use it in exactly one source file.
+ * @param Name              Name of the vector type
+ * @param Type              Element type
+ */
+#define VECTOR_DEFINE(Name, Type)                                                                                  \
+    int Name##Init(Name *vector, Arena *arena, const size_t capacity) {                                            \
+        vector->data = NULL;                                                                                       \
+        vector->length = 0;                                                                                        \
+        vector->capacity = 0;                                                                                      \
+        vector->arena = arena;                                                                                     \
+        return capacity > 0 ? Name##Reserve(vector, capacity) : 0;                                                 \
+    }                                                                                                              \
+                                                                                                                   \
+    void Name##Free(Name *vector) {                                                                                \
+        VectorFreeBlock(vector->data, vector->arena);                                                              \
+        vector->data = NULL;                                                                                       \
+        vector->length = 0;                                                                                        \
+        vector->capacity = 0;                                                                                      \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##Reserve(Name *vector, const size_t capacity) {                                                       \
+        if (capacity <= vector->capacity) {                                                                        \
+            return 0;                                                                                              \
+        }                                                                                                          \
+        void *data = vector->data;                                                                                 \
+        if (VectorGrow(&data, &vector->capacity, vector->arena, sizeof(Type), capacity) != 0) {                    \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        vector->data = data;                                                                                       \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##Push(Name *vector, Type value) {                                                                     \
+        if (vector->length == vector->capacity && Name##Reserve(vector, vector->length + 1) != 0) {                \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        vector->data[vector->length++] = value;                                                                    \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##Insert(Name *vector, const size_t index, Type value) {                                               \
+        if (index > vector->length) {                                                                              \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        if (vector->length == vector->capacity && Name##Reserve(vector, vector->length + 1) != 0) {                \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        MemoryMove(vector->data + index + 1, vector->data + index, (vector->length - index) * sizeof(Type));      \
+        vector->data[index] = value;                                                                               \
+        vector->length++;                                                                                          \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##Append(Name *vector, const Type *items, const size_t count) {                                        \
+        if (count > (size_t) -1 / sizeof(Type) - vector->length) {                                                 \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        if (Name##Reserve(vector, vector->length + count) != 0) {                                                  \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        MemoryCopy(vector->data + vector->length, items, count * sizeof(Type));                                    \
+        vector->length += count;                                                                                   \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##Pop(Name *vector, Type *removed) {                                                                   \
+        if (vector->length == 0) {                                                                                 \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        vector->length--;                                                                                          \
+        if (removed != NULL) {                                                                                     \
+            *removed = vector->data[vector->length];                                                               \
+        }                                                                                                          \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    int Name##SwapRemove(Name *vector, const size_t index, Type *removed) {                                        \
+        if (index >= vector->length) {                                                                             \
+            return 1;                                                                                              \
+        }                                                                                                          \
+        if (removed != NULL) {                                                                                     \
+            *removed = vector->data[index];                                                                        \
+        }                                                                                                          \
+        vector->data[index] = vector->data[--vector->length];                                                      \
+        return 0;                                                                                                  \
+    }                                                                                                              \
+                                                                                                                   \
+    void Name##Sort(Name *vector, int (*compare)(const void *, const void *)) {                                    \
+        if (vector->length > 1) {                                                                                  \
+            qsort(vector->data, vector->length, sizeof(Type), compare);                                            \
+        }                                                                                                          \
+    }                                                                                                              \
+                                                                                                                   \
+    size_t Name##LowerBound(const Name *vector, const Type *key, int (*compare)(const void *, const void *)) {     \
+        size_t low = 0, high = vector->length;                                                                     \
+        while (low < high) {                                                                                       \
+            const size_t middle = low + (high - low) / 2;                                                          \
+            if (compare(&vector->data[middle], key) < 0) {                                                         \
+                low = middle + 1;                                                                                  \
+            }                                                                                                      \
+            else {                                                                                                 \
+                high = middle;                                                                                     \
+            }                                                                                                      \
+        }                                                                                                          \
+        return low;                                                                                                \
+    }                                                                                                              \
+                                                                                                                   \
+    size_t Name##BinarySearch(const Name *vector, const Type *key, int (*compare)(const void *, const void *)) {    \
+        const size_t index = Name##LowerBound(vector, key, compare);                                               \
+        if (index < vector->length && compare(&vector->data[index], key) == 0) {                                   \
+            return index;                                                                                          \
+        }                                                                                                          \
+        return VECTOR_NOT_FOUND;                                                                                   \
+    }
+
+#endif //VECTOR_H